@@ -4,15 +4,28 @@
 // DATE: October, 2020
 // DESC: Implements a resizable array version of the list
 //       class. Elements are added by default to the last available
-//       index in the array. Implementations for selection, insertion,
-//		 merge, and quick sort are included.
+//       index in the array. Only the first length slots hold items;
+//       the rest of the capacity is raw memory, and trivially
+//       copyable items are grown and shifted with realloc and
+//       memmove. Implementations for selection, insertion, merge,
+//       quick, intro, and radix sort are included, along with a
+//       multi-threaded sort.
 //----------------------------------------------------------------------
 
 #ifndef ARRAY_LIST_H
 #define ARRAY_LIST_H
 
 #include "list.h"
+#include "array_slice.h"
 #include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <thread>
+#include <string>
+#include <type_traits>
+#include <cstdlib>
+#include <cstring>
+#include <new>
 
 using namespace std;
 
@@ -28,48 +41,135 @@ public:
   void add(const T& item);
   bool add(size_t index, const T& item);
   bool get(size_t index, T& return_item) const;
+  // unchecked access by reference (index must be < size())
+  T& operator[](size_t index);
+  const T& operator[](size_t index) const;
+  // checked access by reference (throws out_of_range if index >= size())
+  T& at(size_t index);
+  const T& at(size_t index) const;
+  // the underlying array, with items stored contiguously from 0
+  T* data();
+  const T* data() const;
+  // first and one-past-last items, for iterating
+  T* begin();
+  T* end();
+  const T* begin() const;
+  const T* end() const;
+  // read-only view of all the items (valid until the list changes)
+  ArraySlice<T> view() const;
   bool set(size_t index, const T& new_item);
   bool remove(size_t index);
   size_t size() const;
+  // makes room for at least new_capacity items without resizing again
+  void reserve(size_t new_capacity);
+  // gives back any capacity beyond the current size
+  void shrink_to_fit();
   void selection_sort();
   void insertion_sort();
+  // stable: equal items keep their order
   void merge_sort();
   void quick_sort();
+  // quick sort with a median-of-three pivot that switches to heap sort
+  // if it recurses too deep, and to insertion sort on short ranges
+  void intro_sort();
+  // for integer and string items only: LSD radix sort on integers a
+  // byte at a time, MSD radix sort on strings a character at a time
+  void radix_sort();
+  // radix sort for integer and string items, otherwise intro sort
   void sort();
+  // sorts with up to thread_count threads: halves are sorted on their
+  // own threads (down to one piece per thread, sorted as sort() would)
+  // and then merged
+  void sort(size_t thread_count);
+
+protected:
+  // for subclasses with room for inline_capacity items of their own
+  // (see SmallArrayList), used before any heap storage
+  ArrayList(T* inline_items, size_t inline_capacity);
 
 private:
   T* items;
   size_t capacity;
   size_t length;
+  // the subclass's inline storage, or null
+  T* inline_items;
+  size_t inline_capacity;
 
-  // helper to resize items array
+  // helper to resize items array (doubles the capacity)
   void resize();
-  void merge_sort(int start, int end);
+  // moves the items to storage for exactly new_capacity items
+  void reallocate(size_t new_capacity);
+  // capacity of the first allocation
+  static const size_t INITIAL_CAPACITY = 10;
+  // items that can be moved with memcpy and need no destructor
+  static constexpr bool TRIVIAL = is_trivially_copyable<T>::value;
   void quick_sort(int start, int end);
+  // merge and intro sort helpers, each on the range [start, end)
+  static const size_t INSERTION_CUTOFF = 16;
+  void merge_sort(size_t start, size_t end, T* temp);
+  // merges the sorted runs [start, mid) and [mid, end), moving the left
+  // run through temp
+  void merge(size_t start, size_t mid, size_t end, T* temp);
+  // ranges smaller than this are not worth another thread
+  static const size_t PARALLEL_CUTOFF = 10000;
+  void parallel_sort(size_t start, size_t end, T* temp, size_t thread_count);
+  // levels of quick sort allowed before heap sort takes over
+  static size_t depth_limit(size_t count);
+  // radix sort helpers; lists and string buckets this short are
+  // compared instead
+  static const size_t RADIX_CUTOFF = 64;
+  static constexpr bool RADIX_SORTABLE =
+    (is_integral<T>::value && !is_same<T, bool>::value) || is_same<T, string>::value;
+  void lsd_radix_sort();
+  // sorts the count integers at from, using to as scratch, and returns
+  // whichever of the two ends up holding the result
+  static T* lsd_radix_sort(T* from, T* to, size_t count);
+  void msd_radix_sort(size_t start, size_t end, size_t depth, T* temp);
+  // radix sorts [start, end) using temp[start, end) as scratch
+  void radix_sort(size_t start, size_t end, T* temp);
+  void intro_sort(size_t start, size_t end, size_t depth_limit);
+  void insertion_sort(size_t start, size_t end);
+  void heap_sort(size_t start, size_t end);
+  // moves items[start + root] down the heap of count items at start
+  void sift_down(size_t start, size_t root, size_t count);
 };
 
 
 template<typename T>
 ArrayList<T>::ArrayList()
-  : capacity(10), length(0)
+  : items(nullptr), capacity(0), length(0), inline_items(nullptr),
+    inline_capacity(0)
 {
-  items = new T[capacity];
+  // nothing is allocated until the first add
 }
 
 
 template<typename T>
 ArrayList<T>::ArrayList(const ArrayList<T>& rhs)
-  : capacity(10), length(0), items(nullptr)
+  : items(nullptr), capacity(0), length(0), inline_items(nullptr),
+    inline_capacity(0)
 {
   // defer to assignment operator
   *this = rhs;
 }
 
 
-// TODO: Finish the remaining functions below
+template<typename T>
+ArrayList<T>::ArrayList(T* inline_items, size_t inline_capacity)
+  : items(inline_items), capacity(inline_capacity), length(0),
+    inline_items(inline_items), inline_capacity(inline_capacity)
+{
+}
+
+
 template<typename T>
 ArrayList<T>::~ArrayList(){
-  delete [] items;
+  for (size_t i = 0; i < length; i++) {
+    items[i].~T();
+  }
+  if (items != inline_items) {
+    free(items);
+  }
   length = 0;
 }
 
@@ -77,11 +177,18 @@ template<typename T>
 ArrayList<T>& ArrayList<T>::operator=(const ArrayList<T>& rhs){
   size_t i;
   if (this != &rhs) {
-    items = new T[rhs.capacity];
-    length = rhs.length;
+    //drop current items, keeping the storage if it is big enough
+    for (i = 0; i < length; i++) {
+      items[i].~T();
+    }
+    length = 0;
+    if (capacity < rhs.length) {
+      reallocate(rhs.length);
+    }
     for (i = 0; i < rhs.length; i++) {
-      items[i] = rhs.items[i];
+      new (items + i) T(rhs.items[i]);
     }
+    length = rhs.length;
   }
   return *this;
 }
@@ -90,10 +197,12 @@ template<typename T>
 void ArrayList<T>::add(const T& item){
   //check to see if array needs to be resized
   if (length < capacity) {
-    items[length] = item;
+    new (items + length) T(item);
   } else {
+    //item may be in this list, so copy it before the array moves
+    T copy(item);
     this->resize();
-    items[length] = item;
+    new (items + length) T(std::move(copy));
   }
   length++;
 }
@@ -104,16 +213,25 @@ bool ArrayList<T>::add(size_t index, const T& item){
   if (index > length) {
     return false;
   }
-  size_t i;
+  //copied first, since item may be in this list
+  T copy(item);
   //check to see if array needs to be resized
-  if (length == capacity - 1) {
+  if (length == capacity) {
     this->resize();
   }
   //shift elements over by one
-  for (i = length; i > index; --i) {
-    items[i] = items[i-1];
+  if constexpr (TRIVIAL) {
+    memmove(items + index + 1, items + index, (length - index) * sizeof(T));
+    new (items + index) T(std::move(copy));
+  } else if (index == length) {
+    new (items + length) T(std::move(copy));
+  } else {
+    new (items + length) T(std::move(items[length - 1]));
+    for (size_t i = length - 1; i > index; --i) {
+      items[i] = std::move(items[i - 1]);
+    }
+    items[index] = std::move(copy);
   }
-  items[index] = item;
   length++;
 	
   return true;
@@ -130,6 +248,69 @@ bool ArrayList<T>::get(size_t index, T& return_item) const{
   return true;
 }
 
+template<typename T>
+T& ArrayList<T>::operator[](size_t index){
+  return items[index];
+}
+
+template<typename T>
+const T& ArrayList<T>::operator[](size_t index) const{
+  return items[index];
+}
+
+template<typename T>
+T& ArrayList<T>::at(size_t index){
+  if (index >= length) {
+    throw out_of_range("ArrayList::at: index " + to_string(index) +
+                       " >= size " + to_string(length));
+  }
+  return items[index];
+}
+
+template<typename T>
+const T& ArrayList<T>::at(size_t index) const{
+  if (index >= length) {
+    throw out_of_range("ArrayList::at: index " + to_string(index) +
+                       " >= size " + to_string(length));
+  }
+  return items[index];
+}
+
+template<typename T>
+T* ArrayList<T>::data(){
+  return items;
+}
+
+template<typename T>
+const T* ArrayList<T>::data() const{
+  return items;
+}
+
+template<typename T>
+T* ArrayList<T>::begin(){
+  return items;
+}
+
+template<typename T>
+T* ArrayList<T>::end(){
+  return items + length;
+}
+
+template<typename T>
+const T* ArrayList<T>::begin() const{
+  return items;
+}
+
+template<typename T>
+const T* ArrayList<T>::end() const{
+  return items + length;
+}
+
+template<typename T>
+ArraySlice<T> ArrayList<T>::view() const{
+  return ArraySlice<T>(items, length);
+}
+
 template<typename T>
 bool ArrayList<T>::set(size_t index, const T& new_item){
   //boolean condition
@@ -148,10 +329,14 @@ bool ArrayList<T>::remove(size_t index){
   if (index >= length || length == 0) {
     return false;
   }
-  int i;
   //get rid of element at index and move all other elements over
-  for (i = index; i < length - 1; i++) {
-    items[i] = items[i + 1];
+  if constexpr (TRIVIAL) {
+    memmove(items + index, items + index + 1, (length - index - 1) * sizeof(T));
+  } else {
+    for (size_t i = index; i < length - 1; i++) {
+      items[i] = std::move(items[i + 1]);
+    }
+    items[length - 1].~T();
   }
   //update length
   length--;
@@ -164,16 +349,68 @@ size_t ArrayList<T>::size() const{
   return length;
 }
 
+template<typename T>
+void ArrayList<T>::reserve(size_t new_capacity){
+  if (new_capacity > capacity) {
+    reallocate(new_capacity);
+  }
+}
+
+template<typename T>
+void ArrayList<T>::shrink_to_fit(){
+  if (length < capacity) {
+    reallocate(length);
+  }
+}
+
 template<typename T>
 void ArrayList<T>::resize(){
-  T * copy_arr = new T[2 * capacity];
-  size_t i;
-  for (i = 0; i < length; i++) {
-    copy_arr[i] = items[i];
+  reallocate(capacity == 0 ? INITIAL_CAPACITY : 2 * capacity);
+}
+
+template<typename T>
+void ArrayList<T>::reallocate(size_t new_capacity){
+  //use the inline storage (if any) whenever the items fit in it
+  bool use_inline = inline_items != nullptr && new_capacity <= inline_capacity;
+  if (use_inline && items == inline_items) {
+    return;
+  }
+  T* copy_arr;
+  if (use_inline) {
+    copy_arr = inline_items;
+    new_capacity = inline_capacity;
+  } else if (new_capacity == 0) {
+    copy_arr = nullptr;
+  } else {
+    //realloc can often grow in place, and copies the bytes if not
+    //(on failure the old block is untouched, so the list is too). It
+    //only applies to trivial items already on the heap.
+    if constexpr (TRIVIAL) {
+      if (items != inline_items) {
+        T* grown = static_cast<T*>(realloc(items, new_capacity * sizeof(T)));
+        if (grown == nullptr) {
+          throw bad_alloc();
+        }
+        items = grown;
+        capacity = new_capacity;
+        return;
+      }
+    }
+    copy_arr = static_cast<T*>(malloc(new_capacity * sizeof(T)));
+    if (copy_arr == nullptr) {
+      throw bad_alloc();
+    }
+  }
+  //move each item into the new storage, then end the old one
+  for (size_t i = 0; i < length; i++) {
+    new (copy_arr + i) T(std::move(items[i]));
+    items[i].~T();
+  }
+  if (items != inline_items) {
+    free(items);
   }
-  delete [] items;
   items = copy_arr;
-  capacity *= 2;
+  capacity = new_capacity;
 }
 
 template<typename T>
@@ -208,43 +445,55 @@ void ArrayList<T>::insertion_sort(){
 
 template<typename T>
 void ArrayList<T>::merge_sort() {
-  merge_sort(0, length - 1);
+  if (length < 2) {
+    return;
+  }
+  //one scratch buffer for the whole sort, big enough for a left half
+  T* temp = new T[(length + 1) / 2];
+  merge_sort(0, length, temp);
+  delete [] temp;
 }
 
 template<typename T>
-void ArrayList<T>::merge_sort(int start, int end) {
-  int mid;
-  //if list has more than 1 element 
-  if (start < end) {
-    //split in half for recursive calls
-    mid = (start + end) / 2;
-    merge_sort(start, mid);
-    merge_sort(mid + 1, end);
-    //temporary array
-    T temp[(end - start) + 1];
-    int first1 = start;
-    int first2 = mid + 1;
-    int i = 0;
-    //checking element by element for smallest
-    while (first1 <= mid && first2 <= end) {
-      if (items[first1] < items[first2]) {
-        temp[i++] = items[first1++];
-      } else {
-        temp[i++] = items[first2++];
-      }
-    }
-    //once one half is empty
-    while (first1 <= mid) {
-      temp[i++] = items[first1++];
-    }
-    while (first2 <= end) {
-       temp[i++] = items[first2++];
-    }
-    //copying temp back into items
-    for (i = 0; i <= (end - start); i++) {
-      items[start + i] = temp[i];
+void ArrayList<T>::merge_sort(size_t start, size_t end, T* temp) {
+  //short runs are faster to insertion sort (which is also stable)
+  if (end - start <= INSERTION_CUTOFF) {
+    insertion_sort(start, end);
+    return;
+  }
+  //split in half for recursive calls
+  size_t mid = start + (end - start) / 2;
+  merge_sort(start, mid, temp);
+  merge_sort(mid, end, temp);
+  //halves that are already in order need no merge
+  if (items[mid] < items[mid - 1]) {
+    merge(start, mid, end, temp);
+  }
+}
+
+template<typename T>
+void ArrayList<T>::merge(size_t start, size_t mid, size_t end, T* temp) {
+  //move the left half out of the way, then merge forward into items;
+  //the write position never passes the unread right half
+  size_t left_len = mid - start;
+  for (size_t i = 0; i < left_len; ++i) {
+    temp[i] = std::move(items[start + i]);
+  }
+  size_t first1 = 0;
+  size_t first2 = mid;
+  size_t i = start;
+  while (first1 < left_len && first2 < end) {
+    //on ties take the left item, keeping equal items in order
+    if (items[first2] < temp[first1]) {
+      items[i++] = std::move(items[first2++]);
+    } else {
+      items[i++] = std::move(temp[first1++]);
     }
   }
+  //whatever is left of the right half is already in place
+  while (first1 < left_len) {
+    items[i++] = std::move(temp[first1++]);
+  }
 }
 
 template<typename T>
@@ -279,9 +528,294 @@ void ArrayList<T>::quick_sort(int start, int end) {
   }
 }
 
+template<typename T>
+void ArrayList<T>::intro_sort() {
+  intro_sort(0, length, depth_limit(length));
+}
+
+template<typename T>
+size_t ArrayList<T>::depth_limit(size_t count) {
+  //allow 2 * floor(log2(n)) levels before giving up on quick sort
+  size_t limit = 0;
+  for (size_t n = count; n > 1; n /= 2) {
+    limit += 2;
+  }
+  return limit;
+}
+
+template<typename T>
+void ArrayList<T>::intro_sort(size_t start, size_t end, size_t depth_limit) {
+  while (end - start > INSERTION_CUTOFF) {
+    //too many bad pivots, so finish this range in n log n
+    if (depth_limit == 0) {
+      heap_sort(start, end);
+      return;
+    }
+    depth_limit--;
+    //order the first, middle, and last items, and use the middle as the
+    //pivot; the outer two then stop both scans below
+    size_t mid = start + (end - start) / 2;
+    if (items[mid] < items[start]) {
+      std::swap(items[mid], items[start]);
+    }
+    if (items[end - 1] < items[mid]) {
+      std::swap(items[end - 1], items[mid]);
+      if (items[mid] < items[start]) {
+        std::swap(items[mid], items[start]);
+      }
+    }
+    T pivot_val = items[mid];
+    //hoare partition: both scans stop on items equal to the pivot, so
+    //runs of duplicates are split evenly instead of all going one way
+    size_t i = start;
+    size_t j = end - 1;
+    while (true) {
+      while (items[i] < pivot_val) {
+        i++;
+      }
+      while (pivot_val < items[j]) {
+        j--;
+      }
+      if (i >= j) {
+        break;
+      }
+      std::swap(items[i], items[j]);
+      i++;
+      j--;
+    }
+    //now [start, j] <= pivot <= [j + 1, end); recurse on the smaller
+    //side and loop on the larger, so the stack stays O(log n)
+    size_t split = j + 1;
+    if (split - start < end - split) {
+      intro_sort(start, split, depth_limit);
+      start = split;
+    } else {
+      intro_sort(split, end, depth_limit);
+      end = split;
+    }
+  }
+  insertion_sort(start, end);
+}
+
+template<typename T>
+void ArrayList<T>::insertion_sort(size_t start, size_t end) {
+  for (size_t i = start + 1; i < end; ++i) {
+    T curr_val = std::move(items[i]);
+    size_t j = i;
+    while (j > start && curr_val < items[j - 1]) {
+      items[j] = std::move(items[j - 1]);
+      j--;
+    }
+    items[j] = std::move(curr_val);
+  }
+}
+
+template<typename T>
+void ArrayList<T>::heap_sort(size_t start, size_t end) {
+  size_t count = end - start;
+  //build a max heap, then repeatedly move its top to the end
+  for (size_t root = count / 2; root > 0; --root) {
+    sift_down(start, root - 1, count);
+  }
+  for (size_t last = count; last > 1; --last) {
+    std::swap(items[start], items[start + last - 1]);
+    sift_down(start, 0, last - 1);
+  }
+}
+
+template<typename T>
+void ArrayList<T>::sift_down(size_t start, size_t root, size_t count) {
+  T root_val = std::move(items[start + root]);
+  size_t child = 2 * root + 1;
+  while (child < count) {
+    //pick the larger child
+    if (child + 1 < count && items[start + child] < items[start + child + 1]) {
+      child++;
+    }
+    if (!(root_val < items[start + child])) {
+      break;
+    }
+    items[start + root] = std::move(items[start + child]);
+    root = child;
+    child = 2 * root + 1;
+  }
+  items[start + root] = std::move(root_val);
+}
+
+template<typename T>
+void ArrayList<T>::radix_sort() {
+  if (length <= RADIX_CUTOFF) {
+    intro_sort();
+    return;
+  }
+  if constexpr (is_integral<T>::value) {
+    lsd_radix_sort();
+  } else {
+    T* temp = new T[length];
+    msd_radix_sort(0, length, 0, temp);
+    delete [] temp;
+  }
+}
+
+template<typename T>
+void ArrayList<T>::lsd_radix_sort() {
+  //the second array has the same capacity, so it can become items
+  //(integers are trivial, so raw storage is fine)
+  T* spare = static_cast<T*>(malloc(capacity * sizeof(T)));
+  if (spare == nullptr) {
+    throw bad_alloc();
+  }
+  T* sorted = lsd_radix_sort(items, spare, length);
+  if (sorted != items) {
+    if (items == inline_items) {
+      //inline storage can't be handed off, so copy the result back
+      memcpy(items, sorted, length * sizeof(T));
+    } else {
+      spare = items;
+      items = sorted;
+    }
+  }
+  free(spare);
+}
+
+template<typename T>
+T* ArrayList<T>::lsd_radix_sort(T* from, T* to, size_t count) {
+  typedef typename make_unsigned<T>::type U;
+  //flipping the sign bit puts negative numbers before positive ones
+  const U flip = is_signed<T>::value ? (U) 1 << (8 * sizeof(T) - 1) : 0;
+  for (size_t shift = 0; shift < 8 * sizeof(T); shift += 8) {
+    size_t counts[256] = {0};
+    for (size_t i = 0; i < count; ++i) {
+      counts[(((U) from[i] ^ flip) >> shift) & 0xFF]++;
+    }
+    //every item has the same byte here, so the pass would change nothing
+    if (counts[(((U) from[0] ^ flip) >> shift) & 0xFF] == count) {
+      continue;
+    }
+    //turn counts into each byte's first position
+    size_t position = 0;
+    for (size_t b = 0; b < 256; ++b) {
+      size_t bucket_size = counts[b];
+      counts[b] = position;
+      position += bucket_size;
+    }
+    //stable pass, so earlier (lower) bytes stay in order
+    for (size_t i = 0; i < count; ++i) {
+      to[counts[(((U) from[i] ^ flip) >> shift) & 0xFF]++] = from[i];
+    }
+    T* swap_temp = from;
+    from = to;
+    to = swap_temp;
+  }
+  return from;
+}
+
+template<typename T>
+void ArrayList<T>::msd_radix_sort(size_t start, size_t end, size_t depth, T* temp) {
+  while (end - start > RADIX_CUTOFF) {
+    //bucket 0 holds strings with no character at depth (they are all
+    //equal from here on), and bucket c + 1 those with character c
+    size_t counts[257] = {0};
+    for (size_t i = start; i < end; ++i) {
+      size_t bucket = depth < items[i].size() ? (unsigned char) items[i][depth] + 1 : 0;
+      counts[bucket]++;
+    }
+    size_t bucket = depth < items[start].size() ? (unsigned char) items[start][depth] + 1 : 0;
+    //all in one bucket (common for shared prefixes), so nothing moves
+    if (counts[bucket] == end - start) {
+      if (bucket == 0) {
+        return;
+      }
+      depth++;
+      continue;
+    }
+    size_t firsts[257];
+    size_t position = 0;
+    for (size_t b = 0; b < 257; ++b) {
+      firsts[b] = position;
+      position += counts[b];
+    }
+    for (size_t i = start; i < end; ++i) {
+      size_t b = depth < items[i].size() ? (unsigned char) items[i][depth] + 1 : 0;
+      temp[firsts[b]++] = std::move(items[i]);
+    }
+    for (size_t i = 0; i < end - start; ++i) {
+      items[start + i] = std::move(temp[i]);
+    }
+    //each bucket now ends where the next begins
+    size_t bucket_start = start + counts[0];
+    for (size_t b = 1; b < 257; ++b) {
+      if (counts[b] > 1) {
+        msd_radix_sort(bucket_start, bucket_start + counts[b], depth + 1, temp);
+      }
+      bucket_start += counts[b];
+    }
+    return;
+  }
+  insertion_sort(start, end);
+}
+
+template<typename T>
+void ArrayList<T>::radix_sort(size_t start, size_t end, T* temp) {
+  if (end - start <= RADIX_CUTOFF) {
+    intro_sort(start, end, depth_limit(end - start));
+    return;
+  }
+  if constexpr (is_integral<T>::value) {
+    T* sorted = lsd_radix_sort(items + start, temp + start, end - start);
+    if (sorted != items + start) {
+      memcpy(items + start, sorted, (end - start) * sizeof(T));
+    }
+  } else {
+    msd_radix_sort(start, end, 0, temp + start);
+  }
+}
+
 template<typename T>
 void ArrayList<T>::sort() {
-  quick_sort();
+  if constexpr (RADIX_SORTABLE) {
+    radix_sort();
+  } else {
+    intro_sort();
+  }
+}
+
+template<typename T>
+void ArrayList<T>::sort(size_t thread_count) {
+  if (thread_count <= 1 || length <= PARALLEL_CUTOFF) {
+    sort();
+    return;
+  }
+  //each merge uses the part of temp under its own range, so merges on
+  //different threads never share scratch space
+  T* temp = new T[length];
+  parallel_sort(0, length, temp, thread_count);
+  delete [] temp;
+}
+
+template<typename T>
+void ArrayList<T>::parallel_sort(size_t start, size_t end, T* temp, size_t thread_count) {
+  if (thread_count <= 1 || end - start <= PARALLEL_CUTOFF) {
+    //the pieces are sorted the way sort() would sort them
+    if constexpr (RADIX_SORTABLE) {
+      radix_sort(start, end, temp);
+    } else {
+      intro_sort(start, end, depth_limit(end - start));
+    }
+    return;
+  }
+  //fork the left half onto a new thread, sort the right half on this
+  //one, and join before merging
+  size_t mid = start + (end - start) / 2;
+  size_t left_threads = thread_count / 2;
+  thread left([this, start, mid, temp, left_threads] {
+    parallel_sort(start, mid, temp, left_threads);
+  });
+  parallel_sort(mid, end, temp, thread_count - left_threads);
+  left.join();
+  if (items[mid] < items[mid - 1]) {
+    merge(start, mid, end, temp + start);
+  }
 }
 
 #endif
@@ -21,6 +21,8 @@ class ArrayListCollection : public Collection<K,V>
     bool find(const K& key, V& val) const;
     void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
     void keys(ArrayList<K>& all_keys) const;
+    // every pair in one scan of the list
+    void pairs(ArrayList<std::pair<K,V>>& all_pairs) const;
     void sort(ArrayList<K>& all_keys_sorted) const;
     size_t size() const;
 		
@@ -35,11 +37,9 @@ void ArrayListCollection<K,V>::add(const K& key, const V& val) {
 
 template<typename K, typename V>
 void ArrayListCollection<K,V>::remove(const K& key) {
-  std::pair<K,V> curr;
   //search through list to find key to remove
-  for (int i = 0; i < kv_list.size(); ++i) {
-    kv_list.get(i, curr);
-    if (curr.first == key) {
+  for (size_t i = 0; i < kv_list.size(); ++i) {
+    if (kv_list[i].first == key) {
       kv_list.remove(i);
       //return early if found
       return;
@@ -49,27 +49,21 @@ void ArrayListCollection<K,V>::remove(const K& key) {
 
 template<typename K, typename V>
 bool ArrayListCollection<K,V>::find(const K& key, V& val) const {
-  bool found = false;
-  std::pair<K,V> curr;
-  //search through list for desired key
-  for (int i = 0; i < kv_list.size(); ++i) {
-    kv_list.get(i, curr);
+  //search through list for desired key (by reference, nothing copied)
+  for (const std::pair<K,V>& curr : kv_list) {
     if (curr.first == key) {
-      found = true;
       //get key's matching value
       val = curr.second;
-      return found;
+      return true;
     }
   }
-  return found;
+  return false;
 }
 
 template<typename K, typename V>
 void ArrayListCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
-  std::pair<K,V> curr;
   //search through list for keys within range
-  for (int i = 0; i < kv_list.size(); ++i) {
-    kv_list.get(i, curr);
+  for (const std::pair<K,V>& curr : kv_list) {
     if (curr.first >= k1 && curr.first <= k2) {
       //add keys within range to array
       keys.add(curr.first);
@@ -79,14 +73,22 @@ void ArrayListCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys
 
 template<typename K, typename V>
 void ArrayListCollection<K,V>::keys(ArrayList<K>& all_keys) const {
-  std::pair<K,V> curr;
   //add every key in list to array
-  for (size_t i = 0; i < kv_list.size(); ++i) {
-    kv_list.get(i, curr);
+  all_keys.reserve(all_keys.size() + kv_list.size());
+  for (const std::pair<K,V>& curr : kv_list) {
     all_keys.add(curr.first);
   }
 }
 
+template<typename K, typename V>
+void ArrayListCollection<K,V>::pairs(ArrayList<std::pair<K,V>>& all_pairs) const {
+  //the list already holds the pairs
+  all_pairs.reserve(all_pairs.size() + kv_list.size());
+  for (const std::pair<K,V>& curr : kv_list) {
+    all_pairs.add(curr);
+  }
+}
+
 template<typename K, typename V>
 void ArrayListCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
   //get all keys
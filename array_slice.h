@@ -0,0 +1,96 @@
+//----------------------------------------------------------------------
+// FILE: array_slice.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: A read-only view of a contiguous run of items (a pointer and a
+//       length) in some other array, such as an ArrayList. Making a
+//       slice copies nothing. A slice is only valid until the array it
+//       views is changed.
+//----------------------------------------------------------------------
+
+#ifndef ARRAY_SLICE_H
+#define ARRAY_SLICE_H
+
+#include <cstddef>
+
+using namespace std;
+
+template<typename T>
+class ArraySlice
+{
+public:
+  // an empty slice
+  ArraySlice();
+  // view length items starting at items
+  ArraySlice(const T* items, size_t length);
+
+  // sets return_item to the item at the given index, if it is valid
+  bool get(size_t index, T& return_item) const;
+  // unchecked access by reference (index must be < size())
+  const T& operator[](size_t index) const;
+  size_t size() const;
+  bool empty() const;
+  // first and one-past-last items, for iterating
+  const T* begin() const;
+  const T* end() const;
+
+private:
+  const T* items;
+  size_t length;
+};
+
+
+template<typename T>
+ArraySlice<T>::ArraySlice()
+  : items(nullptr), length(0)
+{
+}
+
+
+template<typename T>
+ArraySlice<T>::ArraySlice(const T* items, size_t length)
+  : items(items), length(length)
+{
+}
+
+
+template<typename T>
+bool ArraySlice<T>::get(size_t index, T& return_item) const{
+  if (index >= length) {
+    return false;
+  }
+  return_item = items[index];
+  return true;
+}
+
+
+template<typename T>
+const T& ArraySlice<T>::operator[](size_t index) const{
+  return items[index];
+}
+
+
+template<typename T>
+size_t ArraySlice<T>::size() const{
+  return length;
+}
+
+
+template<typename T>
+bool ArraySlice<T>::empty() const{
+  return length == 0;
+}
+
+
+template<typename T>
+const T* ArraySlice<T>::begin() const{
+  return items;
+}
+
+
+template<typename T>
+const T* ArraySlice<T>::end() const{
+  return items + length;
+}
+
+#endif
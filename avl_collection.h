@@ -12,6 +12,7 @@
 
 #include "collection.h"
 #include "array_list.h"
+#include "value_holder.h"
 
 template<typename K, typename V>
 class AVLCollection : public Collection<K,V> 
@@ -30,11 +31,13 @@ class AVLCollection : public Collection<K,V>
     void sort(ArrayList<K>& all_keys_sorted) const;
     size_t size() const;
     size_t height() const;
+    // merge a batch with the existing keys and rebuild balanced
+    void add_batch(const ArrayList<std::pair<K,V>>& batch);
   
   private:
-    struct Node {
+    // value comes from ValueHolder (and takes no space for empty V)
+    struct Node : ValueHolder<V> {
       K key;
-      V value;
       int height;
       Node* left;
       Node* right;
@@ -62,6 +65,8 @@ class AVLCollection : public Collection<K,V>
     // rebalance the subtree rooted at subtree_root
     Node* rebalance(Node* subtree_root);
     void print_tree(std::string indent, Node* subtree_root);
+    // helper to link nodes[start, end) into a balanced subtree
+    Node* build(Node** nodes, size_t start, size_t end);
 };
 
 template<typename K, typename V>
@@ -393,6 +398,38 @@ AVLCollection<K,V>::rebalance(Node* subtree_root) {
   return subtree_root;
 }
 
+template<typename K, typename V>
+void AVLCollection<K,V>::add_batch(const ArrayList<std::pair<K,V>>& batch) {
+  //existing and new nodes in key order
+  size_t count;
+  Node** nodes = this->merge_batch(root, node_count, batch, count);
+  //relink everything as a balanced tree (a valid AVL tree, since the
+  //halves of every subtree differ in size by at most one)
+  root = build(nodes, 0, count);
+  node_count = count;
+  delete [] nodes;
+}
+
+template<typename K, typename V>
+typename AVLCollection<K,V>::Node*
+AVLCollection<K,V>::build(Node** nodes, size_t start, size_t end) {
+  if (start == end) {
+    return nullptr;
+  }
+  //middle node is the root, each half becomes a subtree
+  size_t mid = start + (end - start) / 2;
+  Node* subtree_root = nodes[mid];
+  subtree_root->left = build(nodes, start, mid);
+  subtree_root->right = build(nodes, mid + 1, end);
+  //the left half is never smaller, so it sets the height
+  if (subtree_root->left) {
+    subtree_root->height = 1 + subtree_root->left->height;
+  } else {
+    subtree_root->height = 1;
+  }
+  return subtree_root;
+}
+
 template<typename K, typename V>
 void AVLCollection<K,V>::print_tree(std::string indent, Node* subtree_root)
 {
@@ -5,7 +5,8 @@
 // DESC: Implements a version of the collection class, in which an ArrayList
 //        is used toapplies the concept of key value pairs to common list 
 //        operations, but additionally, binary search is used to make it
-//        more efficient.
+//        more efficient. The search strategy is a template parameter
+//        (see search_policy.h).
 //----------------------------------------------------------------------
 
 #ifndef BIN_SEARCH_COLLECTION_H
@@ -13,10 +14,14 @@
 
 #include "collection.h"
 #include "array_list.h"
+#include "search_policy.h"
+#include "array_slice.h"
+#include "value_holder.h"
+#include <type_traits>
 
 using namespace std;
 
-template<typename K, typename V>
+template<typename K, typename V, typename Search = BranchlessSearch>
 class BinSearchCollection : public Collection<K,V> 
 {
   public:
@@ -25,138 +30,194 @@ class BinSearchCollection : public Collection<K,V>
     bool find(const K& key, V& val) const;
     void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
     void keys(ArrayList<K>& all_keys) const;
+    // every pair in one scan of the lists
+    void pairs(ArrayList<std::pair<K,V>>& all_pairs) const;
     void sort(ArrayList<K>& all_keys_sorted) const;
     size_t size() const;
+    // merge a batch into the sorted lists in one pass
+    void add_batch(const ArrayList<std::pair<K,V>>& batch);
+    // view of the sorted keys >= k1 and <= k2, without copying (valid
+    // until the next add or remove)
+    ArraySlice<K> range(const K& k1, const K& k2) const;
+    // number of keys >= k1 and <= k2
+    size_t count(const K& k1, const K& k2) const;
 		
   private:
-    ArrayList<std::pair<K,V>> kv_list;
+    //keys in sorted order, with the value for key_list[i] at
+    //val_list[i], so searches only read keys
+    ArrayList<K> key_list;
+    ArrayList<V> val_list;
+    //an empty value type (e.g., NoValue) has nothing to store, so
+    //val_list stays empty
+    static constexpr bool HAS_VALUES = !is_empty<V>::value;
+    //sets index to the first position whose key is >= key
     bool bin_search(const K& key, size_t& index) const;	
+    //first position whose key is >= key, and first whose key is > key
+    size_t lower_bound(const K& key) const;
+    size_t upper_bound(const K& key) const;
 };
 
-template<typename K, typename V>
-void BinSearchCollection<K,V>::add(const K& key, const V& val) {
-  //if the list is empty, add to front
-  if (kv_list.size() == 0) {
-    kv_list.add(std::pair<K,V>(key,val));
-  return;
-  }
-  size_t pos = 0;
-  std::pair<K,V> p;
+template<typename K, typename V, typename Search>
+void BinSearchCollection<K,V,Search>::add(const K& key, const V& val) {
+  size_t pos;
   //won't add if key is already in list
   if (!bin_search(key, pos)) {
-    kv_list.get(pos, p);
-    //if index returned is the place before new key should be added
-    if (p.first < key) {
-      kv_list.add(pos + 1, std::pair<K,V>(key, val));
-    //if index returned is the correct place for the new key
-    } else {
-      kv_list.add(pos, std::pair<K,V>(key, val));
+    key_list.add(pos, key);
+    if constexpr (HAS_VALUES) {
+      val_list.add(pos, val);
     }
   }
 }
 
-template<typename K, typename V>
-void BinSearchCollection<K,V>::remove(const K& key) {
+template<typename K, typename V, typename Search>
+void BinSearchCollection<K,V,Search>::remove(const K& key) {
   size_t pos;
   //only removes if found in bin search
   if (bin_search(key, pos)) {
-    kv_list.remove(pos);
+    key_list.remove(pos);
+    if constexpr (HAS_VALUES) {
+      val_list.remove(pos);
+    }
   }
 }
 
-template<typename K, typename V>
-bool BinSearchCollection<K,V>::find(const K& key, V& val) const {
+template<typename K, typename V, typename Search>
+bool BinSearchCollection<K,V,Search>::find(const K& key, V& val) const {
   size_t index;
-  std::pair<K,V> p;
   //makes sure bin search returned true
   if (bin_search(key, index)) {
-    kv_list.get(index, p);
-    val = p.second;
+    if constexpr (HAS_VALUES) {
+      val = val_list[index];
+    }
     return true;
   }
   return false;
 }
 
-template<typename K, typename V>
-void BinSearchCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
-  size_t pos;
-  std::pair<K,V> p;
-  //find lower constraint using bin search
-  bin_search(k1, pos);
-  kv_list.get(pos, p);
-  // in case index returned was the one before k1
-  if (p.first < k1) {
-    pos = pos + 1;
-    kv_list.get(pos, p);
-  }
-  //adding keys between k1 and k2
-  while (p.first >= k1 && p.first <= k2) {
-    keys.add(p.first);
-    pos = pos + 1;
-    //make sure pos is valid
-    if (!kv_list.get(pos, p)) {
-      return;
-    }
+template<typename K, typename V, typename Search>
+void BinSearchCollection<K,V,Search>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  //copy out of the matching slice of keys
+  ArraySlice<K> matches = range(k1, k2);
+  for (size_t i = 0; i < matches.size(); ++i) {
+    keys.add(matches[i]);
   }
 }
 
-template<typename K, typename V>
-void BinSearchCollection<K,V>::keys(ArrayList<K>& all_keys) const {
-  std::pair<K,V> curr;
+template<typename K, typename V, typename Search>
+void BinSearchCollection<K,V,Search>::keys(ArrayList<K>& all_keys) const {
   //add every key in list to array
-  for (size_t i = 0; i < kv_list.size(); ++i) {
-    kv_list.get(i, curr);
-    all_keys.add(curr.first);
+  for (size_t i = 0; i < key_list.size(); ++i) {
+    all_keys.add(key_list[i]);
   }
 }
 
-template<typename K, typename V>
-void BinSearchCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+template<typename K, typename V, typename Search>
+void BinSearchCollection<K,V,Search>::pairs(ArrayList<std::pair<K,V>>& all_pairs) const {
+  //pair each key with the value at the same index
+  all_pairs.reserve(all_pairs.size() + key_list.size());
+  for (size_t i = 0; i < key_list.size(); ++i) {
+    if constexpr (HAS_VALUES) {
+      all_pairs.add(std::pair<K,V>(key_list[i], val_list[i]));
+    } else {
+      all_pairs.add(std::pair<K,V>(key_list[i], V()));
+    }
+  }
+}
+
+template<typename K, typename V, typename Search>
+void BinSearchCollection<K,V,Search>::sort(ArrayList<K>& all_keys_sorted) const {
   //get all keys, list already sorted
   keys(all_keys_sorted);
 }
 
-template<typename K, typename V>
-size_t BinSearchCollection<K,V>::size() const {
-  return kv_list.size();
+template<typename K, typename V, typename Search>
+size_t BinSearchCollection<K,V,Search>::size() const {
+  return key_list.size();
 }
 
-template<typename K, typename V>
-bool BinSearchCollection<K,V>::bin_search(const K& key, size_t& index) const {
-  bool found = false;
-  //if list is empty, no need to search
-  if (kv_list.size() == 0) {
-    return found;
+template<typename K, typename V, typename Search>
+void BinSearchCollection<K,V,Search>::add_batch(const ArrayList<std::pair<K,V>>& batch) {
+  ArrayList<std::pair<K,V>> sorted;
+  this->sort_batch(batch, sorted);
+  //walk both sorted lists to drop batch keys that are already here
+  size_t i = 0;
+  size_t count = 0;
+  for (size_t j = 0; j < sorted.size(); ++j) {
+    while (i < key_list.size() && key_list[i] < sorted[j].first) {
+      i = i + 1;
+    }
+    if (i == key_list.size() || key_list[i] != sorted[j].first) {
+      sorted[count] = sorted[j];
+      count = count + 1;
+    }
   }
-  size_t low = 0;
-  size_t high = kv_list.size() - 1;
-  size_t mid_index;
-  std::pair<K,V> mid;
-  //while there are still indices to search in the right range and 
-  //key hasn't been found.
-  while (high >= low && !found) {
-    //set mid index
-    mid_index = (high + low) / 2;
-    kv_list.get(mid_index, mid);
-    //if the key should be searched for in the left half
-    if (key < mid.first) {
-      //ensuring high isn't going to be invalid
-      if (high != 0) {
-        high = mid_index - 1;
-      } else {
-        index = mid_index;
-        return found;
+  //grow both lists, then merge from the back so every item moves once
+  //and nothing is overwritten before it has moved
+  size_t old_size = key_list.size();
+  for (size_t j = 0; j < count; ++j) {
+    key_list.add(sorted[j].first);
+    if constexpr (HAS_VALUES) {
+      val_list.add(sorted[j].second);
+    }
+  }
+  i = old_size;
+  size_t j = count;
+  size_t w = old_size + count;
+  while (j > 0) {
+    w = w - 1;
+    if (i > 0 && key_list[i - 1] > sorted[j - 1].first) {
+      i = i - 1;
+      key_list[w] = std::move(key_list[i]);
+      if constexpr (HAS_VALUES) {
+        val_list[w] = std::move(val_list[i]);
+      }
+    } else {
+      j = j - 1;
+      key_list[w] = sorted[j].first;
+      if constexpr (HAS_VALUES) {
+        val_list[w] = sorted[j].second;
       }
-    //if the key should be searched for in the right half
-    } else if (key > mid.first) {
-      low = mid_index + 1;
-    //if the key was found
-    } else if (key == mid.first) {
-      found = true;
     }
   }
-  index = mid_index;
-  return found;
+}
+
+template<typename K, typename V, typename Search>
+ArraySlice<K> BinSearchCollection<K,V,Search>::range(const K& k1, const K& k2) const {
+  size_t start = lower_bound(k1);
+  size_t end = upper_bound(k2);
+  if (end <= start) {
+    return ArraySlice<K>();
+  }
+  return ArraySlice<K>(key_list.data() + start, end - start);
+}
+
+template<typename K, typename V, typename Search>
+size_t BinSearchCollection<K,V,Search>::count(const K& k1, const K& k2) const {
+  //two searches, nothing is visited in between
+  size_t start = lower_bound(k1);
+  size_t end = upper_bound(k2);
+  return (end > start) ? end - start : 0;
+}
+
+template<typename K, typename V, typename Search>
+size_t BinSearchCollection<K,V,Search>::lower_bound(const K& key) const {
+  return Search::lower_bound(key_list, key);
+}
+
+template<typename K, typename V, typename Search>
+size_t BinSearchCollection<K,V,Search>::upper_bound(const K& key) const {
+  //keys are unique, so at most one key equals key
+  size_t index = lower_bound(key);
+  if (index < key_list.size() && key_list[index] == key) {
+    index = index + 1;
+  }
+  return index;
+}
+
+template<typename K, typename V, typename Search>
+bool BinSearchCollection<K,V,Search>::bin_search(const K& key, size_t& index) const {
+  index = lower_bound(key);
+  return index < key_list.size() && key_list[index] == key;
 }
 
 #endif
@@ -12,6 +12,7 @@
 
 #include "collection.h"
 #include "array_list.h"
+#include "value_holder.h"
 
 template<typename K, typename V>
 class BSTCollection : public Collection<K,V> 
@@ -30,11 +31,13 @@ class BSTCollection : public Collection<K,V>
     void sort(ArrayList<K>& all_keys_sorted) const;
     size_t size() const;
     size_t height() const;
+    // merge a batch with the existing keys and rebuild balanced
+    void add_batch(const ArrayList<std::pair<K,V>>& batch);
   
   private:
-    struct Node {
+    // value comes from ValueHolder (and takes no space for empty V)
+    struct Node : ValueHolder<V> {
       K key;
-      V value;
       Node* left;
       Node* right;
     };
@@ -54,6 +57,8 @@ class BSTCollection : public Collection<K,V>
     void keys(const Node* subtree_root, ArrayList<K>& all_keys) const;
     // helper to recursively find height of the tree
     size_t height(const Node* subtree_root) const;
+    // helper to link nodes[start, end) into a balanced subtree
+    Node* build(Node** nodes, size_t start, size_t end);
 };
 
 template<typename K, typename V>
@@ -274,6 +279,31 @@ void BSTCollection<K,V>::keys(const Node* subtree_root, ArrayList<K>& all_keys)
   keys(subtree_root->right, all_keys);
 }
 
+template<typename K, typename V>
+void BSTCollection<K,V>::add_batch(const ArrayList<std::pair<K,V>>& batch) {
+  //existing and new nodes in key order
+  size_t count;
+  Node** nodes = this->merge_batch(root, node_count, batch, count);
+  //relink everything as a balanced tree
+  root = build(nodes, 0, count);
+  node_count = count;
+  delete [] nodes;
+}
+
+template<typename K, typename V>
+typename BSTCollection<K,V>::Node*
+BSTCollection<K,V>::build(Node** nodes, size_t start, size_t end) {
+  if (start == end) {
+    return nullptr;
+  }
+  //middle node is the root, each half becomes a subtree
+  size_t mid = start + (end - start) / 2;
+  Node* subtree_root = nodes[mid];
+  subtree_root->left = build(nodes, start, mid);
+  subtree_root->right = build(nodes, mid + 1, end);
+  return subtree_root;
+}
+
 template<typename K, typename V>
 size_t BSTCollection<K,V>::height(const Node* subtree_root) const {
   //base case
@@ -0,0 +1,545 @@
+//----------------------------------------------------------------------
+// FILE: btree_collection.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a version of the collection class using a B+ tree.
+//        Nodes hold many keys (sized to span a few cache lines), so a
+//        search touches far fewer nodes than a binary tree does. All
+//        key-value pairs live in the leaves, which are linked in key
+//        order for range finds and sorting. Within a node, signed 32
+//        and 64-bit integer keys are searched with SIMD compares.
+//----------------------------------------------------------------------
+
+#ifndef BTREE_COLLECTION_H
+#define BTREE_COLLECTION_H
+
+#include "collection.h"
+#include "array_list.h"
+#include <type_traits>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+template<typename K, typename V>
+class BTreeCollection : public Collection<K,V>
+{
+  public:
+    BTreeCollection();
+    BTreeCollection(const BTreeCollection<K,V>& rhs);
+    ~BTreeCollection();
+    BTreeCollection& operator=(const BTreeCollection<K,V>& rhs);
+
+    void add(const K& key, const V& val);
+    void remove(const K& key);
+    bool find(const K& key, V& val) const;
+    void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
+    void keys(ArrayList<K>& all_keys) const;
+    void sort(ArrayList<K>& all_keys_sorted) const;
+    size_t size() const;
+    size_t height() const;
+
+  private:
+    // keys per node: about four cache lines of keys, but at least 8
+    static const size_t MAX_KEYS = (256 / sizeof(K) > 8) ? 256 / sizeof(K) : 8;
+    static const size_t MIN_KEYS = MAX_KEYS / 2;
+    // arrays have one extra entry so a node can overflow before a split
+    struct Node {
+      bool leaf;
+      size_t count;
+      K keys[MAX_KEYS + 1];
+    };
+    struct Internal : Node {
+      Node* children[MAX_KEYS + 2];
+    };
+    struct Leaf : Node {
+      V values[MAX_KEYS + 1];
+      Leaf* next;
+    };
+    Node* root;
+    // number of keys (not nodes)
+    size_t length;
+    // number of keys in the node that are < key (resp. <= key)
+    static size_t count_less(const K* keys, size_t n, const K& key);
+    static size_t count_less_equal(const K* keys, size_t n, const K& key);
+    // leaf that would hold key
+    const Leaf* find_leaf(const K& key) const;
+    // leftmost leaf
+    const Leaf* first_leaf() const;
+    // add helper, returns the new right sibling if the node split
+    Node* add(Node* subtree_root, const K& key, const V& val, K& separator);
+    // remove helper, returns true if the node now has too few keys
+    bool remove(Node* subtree_root, const K& key);
+    // borrow from or merge with a sibling of parent->children[i]
+    void fix_child(Internal* parent, size_t i);
+    void make_empty(Node* subtree_root);
+};
+
+template<typename K, typename V>
+BTreeCollection<K,V>::BTreeCollection()
+  : root(nullptr), length(0)
+{
+}
+
+template<typename K, typename V>
+BTreeCollection<K,V>::BTreeCollection(const BTreeCollection<K,V>& rhs)
+  : root(nullptr), length(0)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+template<typename K, typename V>
+BTreeCollection<K,V>::~BTreeCollection() {
+  make_empty(root);
+}
+
+template<typename K, typename V>
+BTreeCollection<K,V>& BTreeCollection<K,V>::operator=(const BTreeCollection<K,V>& rhs) {
+  if (this != &rhs) {
+    make_empty(root);
+    root = nullptr;
+    length = 0;
+    //add each pair in key order from the leaf chain
+    for (const Leaf* leaf = rhs.first_leaf(); leaf != nullptr; leaf = leaf->next) {
+      for (size_t i = 0; i < leaf->count; ++i) {
+        add(leaf->keys[i], leaf->values[i]);
+      }
+    }
+  }
+  return *this;
+}
+
+template<typename K, typename V>
+void BTreeCollection<K,V>::add(const K& key, const V& val) {
+  //first key creates a leaf root
+  if (root == nullptr) {
+    Leaf* leaf = new Leaf;
+    leaf->leaf = true;
+    leaf->count = 0;
+    leaf->next = nullptr;
+    root = leaf;
+  }
+  K separator;
+  Node* sibling = add(root, key, val, separator);
+  //root split, so the tree grows a level
+  if (sibling != nullptr) {
+    Internal* new_root = new Internal;
+    new_root->leaf = false;
+    new_root->count = 1;
+    new_root->keys[0] = separator;
+    new_root->children[0] = root;
+    new_root->children[1] = sibling;
+    root = new_root;
+  }
+  length++;
+}
+
+template<typename K, typename V>
+void BTreeCollection<K,V>::remove(const K& key) {
+  if (root == nullptr) {
+    return;
+  }
+  remove(root, key);
+  //shrink the tree when the root runs out of keys
+  if (root->count == 0) {
+    Node* old_root = root;
+    if (root->leaf) {
+      root = nullptr;
+    } else {
+      root = static_cast<Internal*>(root)->children[0];
+    }
+    if (old_root->leaf) {
+      delete static_cast<Leaf*>(old_root);
+    } else {
+      delete static_cast<Internal*>(old_root);
+    }
+  }
+}
+
+template<typename K, typename V>
+bool BTreeCollection<K,V>::find(const K& key, V& val) const {
+  const Leaf* leaf = find_leaf(key);
+  if (leaf == nullptr) {
+    return false;
+  }
+  size_t i = count_less(leaf->keys, leaf->count, key);
+  if (i < leaf->count && leaf->keys[i] == key) {
+    val = leaf->values[i];
+    return true;
+  }
+  return false;
+}
+
+template<typename K, typename V>
+void BTreeCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  const Leaf* leaf = find_leaf(k1);
+  if (leaf == nullptr) {
+    return;
+  }
+  //start at the first key >= k1, then follow the leaf chain
+  size_t i = count_less(leaf->keys, leaf->count, k1);
+  while (leaf != nullptr) {
+    for (; i < leaf->count; ++i) {
+      if (leaf->keys[i] > k2) {
+        return;
+      }
+      keys.add(leaf->keys[i]);
+    }
+    leaf = leaf->next;
+    i = 0;
+  }
+}
+
+template<typename K, typename V>
+void BTreeCollection<K,V>::keys(ArrayList<K>& all_keys) const {
+  for (const Leaf* leaf = first_leaf(); leaf != nullptr; leaf = leaf->next) {
+    for (size_t i = 0; i < leaf->count; ++i) {
+      all_keys.add(leaf->keys[i]);
+    }
+  }
+}
+
+template<typename K, typename V>
+void BTreeCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+  //leaf chain is already in sorted order
+  keys(all_keys_sorted);
+}
+
+template<typename K, typename V>
+size_t BTreeCollection<K,V>::size() const {
+  return length;
+}
+
+template<typename K, typename V>
+size_t BTreeCollection<K,V>::height() const {
+  //all leaves are at the same depth
+  size_t levels = 0;
+  for (const Node* curr = root; curr != nullptr; ++levels) {
+    if (curr->leaf) {
+      curr = nullptr;
+    } else {
+      curr = static_cast<const Internal*>(curr)->children[0];
+    }
+  }
+  return levels;
+}
+
+template<typename K, typename V>
+size_t BTreeCollection<K,V>::count_less(const K* keys, size_t n, const K& key) {
+  size_t i = 0;
+  size_t count = 0;
+#if defined(__SSE2__)
+  if constexpr (is_integral<K>::value && is_signed<K>::value && sizeof(K) == 4) {
+    //compare four keys at a time, each lane is -1 where keys[j] < key
+    __m128i search = _mm_set1_epi32((int)key);
+    for (; i + 4 <= n; i += 4) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(keys + i));
+      int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(search, block)));
+      count += __builtin_popcount(mask);
+    }
+  }
+#endif
+#if defined(__SSE4_2__)
+  if constexpr (is_integral<K>::value && is_signed<K>::value && sizeof(K) == 8) {
+    __m128i search = _mm_set1_epi64x((long long)key);
+    for (; i + 2 <= n; i += 2) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(keys + i));
+      int mask = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(search, block)));
+      count += __builtin_popcount(mask);
+    }
+  }
+#endif
+  if (i == 0) {
+    //binary search for everything else
+    size_t low = 0;
+    size_t high = n;
+    while (low < high) {
+      size_t mid = (low + high) / 2;
+      if (keys[mid] < key) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  }
+  //finish the SIMD tail one key at a time
+  for (; i < n; ++i) {
+    count += (keys[i] < key);
+  }
+  return count;
+}
+
+template<typename K, typename V>
+size_t BTreeCollection<K,V>::count_less_equal(const K* keys, size_t n, const K& key) {
+  size_t i = 0;
+  size_t count = 0;
+#if defined(__SSE2__)
+  if constexpr (is_integral<K>::value && is_signed<K>::value && sizeof(K) == 4) {
+    //lanes are -1 where keys[j] > key, everything else is <= key
+    __m128i search = _mm_set1_epi32((int)key);
+    for (; i + 4 <= n; i += 4) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(keys + i));
+      int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(block, search)));
+      count += 4 - __builtin_popcount(mask);
+    }
+  }
+#endif
+#if defined(__SSE4_2__)
+  if constexpr (is_integral<K>::value && is_signed<K>::value && sizeof(K) == 8) {
+    __m128i search = _mm_set1_epi64x((long long)key);
+    for (; i + 2 <= n; i += 2) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(keys + i));
+      int mask = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(block, search)));
+      count += 2 - __builtin_popcount(mask);
+    }
+  }
+#endif
+  if (i == 0) {
+    size_t low = 0;
+    size_t high = n;
+    while (low < high) {
+      size_t mid = (low + high) / 2;
+      if (!(key < keys[mid])) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  }
+  for (; i < n; ++i) {
+    count += !(key < keys[i]);
+  }
+  return count;
+}
+
+template<typename K, typename V>
+const typename BTreeCollection<K,V>::Leaf*
+BTreeCollection<K,V>::find_leaf(const K& key) const {
+  const Node* curr = root;
+  while (curr != nullptr && !curr->leaf) {
+    //child i holds keys between separators i-1 and i
+    const Internal* node = static_cast<const Internal*>(curr);
+    curr = node->children[count_less_equal(node->keys, node->count, key)];
+  }
+  return static_cast<const Leaf*>(curr);
+}
+
+template<typename K, typename V>
+const typename BTreeCollection<K,V>::Leaf*
+BTreeCollection<K,V>::first_leaf() const {
+  const Node* curr = root;
+  while (curr != nullptr && !curr->leaf) {
+    curr = static_cast<const Internal*>(curr)->children[0];
+  }
+  return static_cast<const Leaf*>(curr);
+}
+
+template<typename K, typename V>
+typename BTreeCollection<K,V>::Node*
+BTreeCollection<K,V>::add(Node* subtree_root, const K& key, const V& val, K& separator) {
+  if (subtree_root->leaf) {
+    Leaf* leaf = static_cast<Leaf*>(subtree_root);
+    //shift larger keys over and insert
+    size_t pos = count_less(leaf->keys, leaf->count, key);
+    for (size_t j = leaf->count; j > pos; --j) {
+      leaf->keys[j] = leaf->keys[j - 1];
+      leaf->values[j] = leaf->values[j - 1];
+    }
+    leaf->keys[pos] = key;
+    leaf->values[pos] = val;
+    leaf->count++;
+    if (leaf->count <= MAX_KEYS) {
+      return nullptr;
+    }
+    //split the overflowing leaf in half
+    Leaf* right = new Leaf;
+    right->leaf = true;
+    size_t half = leaf->count / 2;
+    right->count = leaf->count - half;
+    for (size_t j = 0; j < right->count; ++j) {
+      right->keys[j] = leaf->keys[half + j];
+      right->values[j] = leaf->values[half + j];
+    }
+    leaf->count = half;
+    right->next = leaf->next;
+    leaf->next = right;
+    separator = right->keys[0];
+    return right;
+  }
+  Internal* node = static_cast<Internal*>(subtree_root);
+  size_t i = count_less_equal(node->keys, node->count, key);
+  K child_separator;
+  Node* child_sibling = add(node->children[i], key, val, child_separator);
+  if (child_sibling == nullptr) {
+    return nullptr;
+  }
+  //child split, so add its new sibling to this node
+  for (size_t j = node->count; j > i; --j) {
+    node->keys[j] = node->keys[j - 1];
+    node->children[j + 1] = node->children[j];
+  }
+  node->keys[i] = child_separator;
+  node->children[i + 1] = child_sibling;
+  node->count++;
+  if (node->count <= MAX_KEYS) {
+    return nullptr;
+  }
+  //split the overflowing internal node, moving the middle key up
+  Internal* right = new Internal;
+  right->leaf = false;
+  size_t mid = node->count / 2;
+  right->count = node->count - mid - 1;
+  for (size_t j = 0; j < right->count; ++j) {
+    right->keys[j] = node->keys[mid + 1 + j];
+    right->children[j] = node->children[mid + 1 + j];
+  }
+  right->children[right->count] = node->children[node->count];
+  separator = node->keys[mid];
+  node->count = mid;
+  return right;
+}
+
+template<typename K, typename V>
+bool BTreeCollection<K,V>::remove(Node* subtree_root, const K& key) {
+  if (subtree_root->leaf) {
+    Leaf* leaf = static_cast<Leaf*>(subtree_root);
+    size_t pos = count_less(leaf->keys, leaf->count, key);
+    //key not found
+    if (pos == leaf->count || leaf->keys[pos] != key) {
+      return false;
+    }
+    for (size_t j = pos + 1; j < leaf->count; ++j) {
+      leaf->keys[j - 1] = leaf->keys[j];
+      leaf->values[j - 1] = leaf->values[j];
+    }
+    leaf->count--;
+    length--;
+    return leaf->count < MIN_KEYS;
+  }
+  Internal* node = static_cast<Internal*>(subtree_root);
+  size_t i = count_less_equal(node->keys, node->count, key);
+  if (remove(node->children[i], key)) {
+    fix_child(node, i);
+  }
+  return node->count < MIN_KEYS;
+}
+
+template<typename K, typename V>
+void BTreeCollection<K,V>::fix_child(Internal* parent, size_t i) {
+  Node* child = parent->children[i];
+  Node* left = (i > 0) ? parent->children[i - 1] : nullptr;
+  Node* right = (i < parent->count) ? parent->children[i + 1] : nullptr;
+  //borrow the last key of the left sibling
+  if (left != nullptr && left->count > MIN_KEYS) {
+    for (size_t j = child->count; j > 0; --j) {
+      child->keys[j] = child->keys[j - 1];
+    }
+    if (child->leaf) {
+      Leaf* c = static_cast<Leaf*>(child);
+      Leaf* l = static_cast<Leaf*>(left);
+      for (size_t j = c->count; j > 0; --j) {
+        c->values[j] = c->values[j - 1];
+      }
+      c->keys[0] = l->keys[l->count - 1];
+      c->values[0] = l->values[l->count - 1];
+      parent->keys[i - 1] = c->keys[0];
+    } else {
+      Internal* c = static_cast<Internal*>(child);
+      Internal* l = static_cast<Internal*>(left);
+      for (size_t j = c->count + 1; j > 0; --j) {
+        c->children[j] = c->children[j - 1];
+      }
+      c->keys[0] = parent->keys[i - 1];
+      c->children[0] = l->children[l->count];
+      parent->keys[i - 1] = l->keys[l->count - 1];
+    }
+    left->count--;
+    child->count++;
+    return;
+  }
+  //borrow the first key of the right sibling
+  if (right != nullptr && right->count > MIN_KEYS) {
+    if (child->leaf) {
+      Leaf* c = static_cast<Leaf*>(child);
+      Leaf* r = static_cast<Leaf*>(right);
+      c->keys[c->count] = r->keys[0];
+      c->values[c->count] = r->values[0];
+      for (size_t j = 1; j < r->count; ++j) {
+        r->keys[j - 1] = r->keys[j];
+        r->values[j - 1] = r->values[j];
+      }
+      parent->keys[i] = r->keys[0];
+    } else {
+      Internal* c = static_cast<Internal*>(child);
+      Internal* r = static_cast<Internal*>(right);
+      c->keys[c->count] = parent->keys[i];
+      c->children[c->count + 1] = r->children[0];
+      parent->keys[i] = r->keys[0];
+      for (size_t j = 1; j < r->count; ++j) {
+        r->keys[j - 1] = r->keys[j];
+      }
+      for (size_t j = 1; j <= r->count; ++j) {
+        r->children[j - 1] = r->children[j];
+      }
+    }
+    right->count--;
+    child->count++;
+    return;
+  }
+  //neither sibling can spare a key, so merge with one of them
+  size_t j = (left != nullptr) ? i - 1 : i;
+  Node* l_node = parent->children[j];
+  Node* r_node = parent->children[j + 1];
+  if (l_node->leaf) {
+    Leaf* l = static_cast<Leaf*>(l_node);
+    Leaf* r = static_cast<Leaf*>(r_node);
+    for (size_t k = 0; k < r->count; ++k) {
+      l->keys[l->count + k] = r->keys[k];
+      l->values[l->count + k] = r->values[k];
+    }
+    l->count += r->count;
+    l->next = r->next;
+    delete r;
+  } else {
+    //the separator comes down between the two halves
+    Internal* l = static_cast<Internal*>(l_node);
+    Internal* r = static_cast<Internal*>(r_node);
+    l->keys[l->count] = parent->keys[j];
+    for (size_t k = 0; k < r->count; ++k) {
+      l->keys[l->count + 1 + k] = r->keys[k];
+    }
+    for (size_t k = 0; k <= r->count; ++k) {
+      l->children[l->count + 1 + k] = r->children[k];
+    }
+    l->count += r->count + 1;
+    delete r;
+  }
+  //remove separator j and child j+1 from the parent
+  for (size_t k = j + 1; k < parent->count; ++k) {
+    parent->keys[k - 1] = parent->keys[k];
+    parent->children[k] = parent->children[k + 1];
+  }
+  parent->count--;
+}
+
+template<typename K, typename V>
+void BTreeCollection<K,V>::make_empty(Node* subtree_root) {
+  if (subtree_root == nullptr) {
+    return;
+  }
+  if (subtree_root->leaf) {
+    delete static_cast<Leaf*>(subtree_root);
+    return;
+  }
+  Internal* node = static_cast<Internal*>(subtree_root);
+  for (size_t i = 0; i <= node->count; ++i) {
+    make_empty(node->children[i]);
+  }
+  delete node;
+}
+
+#endif
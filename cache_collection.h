@@ -0,0 +1,364 @@
+//----------------------------------------------------------------------
+// FILE: cache_collection.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a capacity-bounded cache version of the collection
+//        class. A HashTableCollection maps each key to its node, and
+//        the nodes are ordered for eviction by one of two policies:
+//          LRU:   a doubly linked list in recency order, where a hit
+//                 moves the node to the front and the back is evicted
+//          CLOCK: an array of slots with a reference bit per node,
+//                 where a hand sweeps past (and clears) referenced
+//                 nodes and evicts the first unreferenced one. The
+//                 new node takes the victim's slot and the hand moves
+//                 on past it.
+//        Find, add, remove and evict are all O(1) (amortized for
+//        CLOCK). Finds count as cache hits or misses.
+//----------------------------------------------------------------------
+
+#ifndef CACHE_COLLECTION_H
+#define CACHE_COLLECTION_H
+
+#include "collection.h"
+#include "array_list.h"
+#include "hash_table_collection.h"
+
+using namespace std;
+
+template<typename K, typename V>
+class CacheCollection : public Collection<K,V>
+{
+  public:
+    // eviction policies
+    enum policy_t {LRU, CLOCK};
+
+    CacheCollection(size_t capacity, policy_t policy = LRU);
+    CacheCollection(const CacheCollection<K,V>& rhs);
+    ~CacheCollection();
+    CacheCollection& operator=(const CacheCollection<K,V>& rhs);
+
+    // add a key-value pair, evicting one if the cache is full. If the
+    // key is already cached its value is replaced.
+    void add(const K& key, const V& val);
+    void remove(const K& key);
+    // find counts as a use of the key for eviction purposes
+    bool find(const K& key, V& val) const;
+    void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
+    // keys are returned from most to least recently used (LRU) or in
+    // slot order (CLOCK)
+    void keys(ArrayList<K>& all_keys) const;
+    void sort(ArrayList<K>& all_keys_sorted) const;
+    size_t size() const;
+
+    // cache counters
+    size_t capacity() const;
+    size_t hits() const;
+    size_t misses() const;
+    size_t evictions() const;
+    double hit_ratio() const;
+
+  private:
+    struct Node {
+      K key;
+      V value;
+      // LRU list links
+      Node* prev;
+      Node* next;
+      // CLOCK reference bit and slot index
+      bool referenced;
+      size_t slot;
+    };
+    policy_t policy;
+    size_t max_size;
+    // key to node index
+    HashTableCollection<K,Node*> index;
+    // LRU recency list (head is most recently used), mutable since
+    // finds reorder it
+    mutable Node* head;
+    mutable Node* tail;
+    // CLOCK slots and hand
+    Node** slots;
+    size_t hand;
+    size_t length;
+    mutable size_t hit_count;
+    mutable size_t miss_count;
+    size_t eviction_count;
+    // LRU list helpers
+    void unlink(Node* node) const;
+    void push_front(Node* node) const;
+    // remove the node chosen by the policy (for CLOCK, the victim's
+    // slot at hand is left for add to fill)
+    void evict();
+    // unlink a node from the policy structures, index and free it
+    // (for CLOCK, the last slot moves into its place)
+    void discard(Node* node);
+    void make_empty();
+};
+
+template<typename K, typename V>
+CacheCollection<K,V>::CacheCollection(size_t capacity, policy_t policy)
+  : policy(policy), max_size(capacity), head(nullptr), tail(nullptr),
+    hand(0), length(0), hit_count(0), miss_count(0), eviction_count(0)
+{
+  slots = new Node*[max_size];
+}
+
+template<typename K, typename V>
+CacheCollection<K,V>::CacheCollection(const CacheCollection<K,V>& rhs)
+  : policy(rhs.policy), max_size(rhs.max_size), head(nullptr), tail(nullptr),
+    hand(0), length(0), hit_count(0), miss_count(0), eviction_count(0)
+{
+  slots = new Node*[max_size];
+  // defer to assignment operator
+  *this = rhs;
+}
+
+template<typename K, typename V>
+CacheCollection<K,V>::~CacheCollection() {
+  make_empty();
+  delete [] slots;
+}
+
+template<typename K, typename V>
+CacheCollection<K,V>& CacheCollection<K,V>::operator=(const CacheCollection<K,V>& rhs) {
+  if (this != &rhs) {
+    make_empty();
+    delete [] slots;
+    policy = rhs.policy;
+    max_size = rhs.max_size;
+    slots = new Node*[max_size];
+    //add oldest first so the copy has the same recency order
+    if (rhs.policy == LRU) {
+      for (Node* curr = rhs.tail; curr != nullptr; curr = curr->prev) {
+        add(curr->key, curr->value);
+      }
+    } else {
+      for (size_t i = 0; i < rhs.length; ++i) {
+        add(rhs.slots[i]->key, rhs.slots[i]->value);
+        slots[i]->referenced = rhs.slots[i]->referenced;
+      }
+      hand = rhs.hand;
+    }
+    hit_count = rhs.hit_count;
+    miss_count = rhs.miss_count;
+    eviction_count = rhs.eviction_count;
+  }
+  return *this;
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::add(const K& k, const V& val) {
+  if (max_size == 0) {
+    return;
+  }
+  //replace the value of a key that is already cached
+  Node* node = nullptr;
+  if (index.find(k, node)) {
+    node->value = val;
+    if (policy == LRU) {
+      unlink(node);
+      push_front(node);
+    } else {
+      node->referenced = true;
+    }
+    return;
+  }
+  size_t slot = length;
+  if (length == max_size) {
+    evict();
+    if (policy == CLOCK) {
+      //take the victim's slot and move the hand past it, so the new
+      //entry is only reached after a full sweep
+      slot = hand;
+      hand = (hand + 1) % max_size;
+    }
+  }
+  node = new Node;
+  node->key = k;
+  node->value = val;
+  if (policy == LRU) {
+    push_front(node);
+  } else {
+    //new entries start unreferenced, so a one-time key is evicted on
+    //the hand's next pass
+    node->referenced = false;
+    node->slot = slot;
+    slots[slot] = node;
+  }
+  index.add(k, node);
+  length = length + 1;
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::remove(const K& k) {
+  Node* node = nullptr;
+  if (index.find(k, node)) {
+    discard(node);
+  }
+}
+
+template<typename K, typename V>
+bool CacheCollection<K,V>::find(const K& k, V& v) const {
+  Node* node = nullptr;
+  if (!index.find(k, node)) {
+    miss_count++;
+    return false;
+  }
+  hit_count++;
+  //record the use for the eviction policy
+  if (policy == LRU) {
+    if (node != head) {
+      unlink(node);
+      push_front(node);
+    }
+  } else {
+    node->referenced = true;
+  }
+  v = node->value;
+  return true;
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  //range finds don't count as uses
+  ArrayList<K> all_keys;
+  this->keys(all_keys);
+  for (const K& key : all_keys) {
+    if (key >= k1 && key <= k2) {
+      keys.add(key);
+    }
+  }
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::keys(ArrayList<K>& all_keys) const {
+  if (policy == LRU) {
+    for (Node* curr = head; curr != nullptr; curr = curr->next) {
+      all_keys.add(curr->key);
+    }
+  } else {
+    for (size_t i = 0; i < length; ++i) {
+      all_keys.add(slots[i]->key);
+    }
+  }
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+  //get all keys
+  keys(all_keys_sorted);
+  //sort resulting array
+  all_keys_sorted.sort();
+}
+
+template<typename K, typename V>
+size_t CacheCollection<K,V>::size() const {
+  return length;
+}
+
+template<typename K, typename V>
+size_t CacheCollection<K,V>::capacity() const {
+  return max_size;
+}
+
+template<typename K, typename V>
+size_t CacheCollection<K,V>::hits() const {
+  return hit_count;
+}
+
+template<typename K, typename V>
+size_t CacheCollection<K,V>::misses() const {
+  return miss_count;
+}
+
+template<typename K, typename V>
+size_t CacheCollection<K,V>::evictions() const {
+  return eviction_count;
+}
+
+template<typename K, typename V>
+double CacheCollection<K,V>::hit_ratio() const {
+  if (hit_count + miss_count == 0) {
+    return 0;
+  }
+  return hit_count * 1.0 / (hit_count + miss_count);
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::unlink(Node* node) const {
+  if (node->prev != nullptr) {
+    node->prev->next = node->next;
+  } else {
+    head = node->next;
+  }
+  if (node->next != nullptr) {
+    node->next->prev = node->prev;
+  } else {
+    tail = node->prev;
+  }
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::push_front(Node* node) const {
+  node->prev = nullptr;
+  node->next = head;
+  if (head != nullptr) {
+    head->prev = node;
+  } else {
+    tail = node;
+  }
+  head = node;
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::evict() {
+  if (policy == LRU) {
+    discard(tail);
+  } else {
+    //give referenced nodes a second chance
+    while (slots[hand]->referenced) {
+      slots[hand]->referenced = false;
+      hand = (hand + 1) % length;
+    }
+    //the slot stays where it is for the new node (no compacting)
+    index.remove(slots[hand]->key);
+    delete slots[hand];
+    length = length - 1;
+  }
+  eviction_count++;
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::discard(Node* node) {
+  if (policy == LRU) {
+    unlink(node);
+  } else {
+    //fill the hole with the last slot so the slots stay packed, and
+    //keep the hand on the same node if that one moved
+    size_t last = length - 1;
+    slots[node->slot] = slots[last];
+    slots[node->slot]->slot = node->slot;
+    if (hand == last) {
+      hand = (node->slot == last) ? 0 : node->slot;
+    }
+  }
+  index.remove(node->key);
+  delete node;
+  length = length - 1;
+}
+
+template<typename K, typename V>
+void CacheCollection<K,V>::make_empty() {
+  if (policy == LRU) {
+    while (head != nullptr) {
+      discard(head);
+    }
+  } else {
+    while (length > 0) {
+      discard(slots[length - 1]);
+    }
+  }
+  hand = 0;
+}
+
+#endif
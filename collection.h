@@ -27,6 +27,7 @@
 #define COLLECTION_H
 
 #include "array_list.h"
+#include <utility>
 
 
 template<typename K, typename V>
@@ -59,7 +60,125 @@ public:
   // return the number of key-value pairs in the collection
   virtual size_t size() const = 0;
 
+  // return every key-value pair, by default one find per key
+  // (collections with slow finds override this to scan once)
+  virtual void pairs(ArrayList<std::pair<K,V>>& all_pairs) const;
+
+  // add many key-value pairs at once, by default one add per pair
+  // (sorted collections override this to merge the batch in)
+  virtual void add_batch(const ArrayList<std::pair<K,V>>& batch);
+
+protected:
+
+  // copy the batch into sorted, ordered by key with only the last
+  // pair added for a repeated key kept (for collections that merge a
+  // batch in key order)
+  static void sort_batch(const ArrayList<std::pair<K,V>>& batch,
+                         ArrayList<std::pair<K,V>>& sorted);
+
+  // for trees (Node has key, value, left and right): list the tree's
+  // nodes in key order with a new node merged in for each batch key
+  // not already there. Returns the array (the caller deletes it) and
+  // sets count to its length; children are left for the caller's
+  // rebuild to link.
+  template<typename Node>
+  static Node** merge_batch(Node* root, size_t node_count,
+                            const ArrayList<std::pair<K,V>>& batch,
+                            size_t& count);
+
+  // helper to list a tree's nodes in key order
+  template<typename Node>
+  static void flatten(Node* subtree_root, Node** nodes, size_t& count);
+
 };
 
 
+template<typename K, typename V>
+void Collection<K,V>::pairs(ArrayList<std::pair<K,V>>& all_pairs) const
+{
+  ArrayList<K> all_keys;
+  keys(all_keys);
+  all_pairs.reserve(all_pairs.size() + all_keys.size());
+  for (size_t i = 0; i < all_keys.size(); ++i) {
+    V val;
+    find(all_keys[i], val);
+    all_pairs.add(std::pair<K,V>(all_keys[i], val));
+  }
+}
+
+
+template<typename K, typename V>
+void Collection<K,V>::add_batch(const ArrayList<std::pair<K,V>>& batch)
+{
+  for (size_t i = 0; i < batch.size(); ++i)
+    add(batch[i].first, batch[i].second);
+}
+
+
+template<typename K, typename V>
+void Collection<K,V>::sort_batch(const ArrayList<std::pair<K,V>>& batch,
+                                 ArrayList<std::pair<K,V>>& sorted)
+{
+  // sorting (key, position) pairs is a stable sort by key alone, so
+  // values are never compared
+  ArrayList<std::pair<K,size_t>> order;
+  order.reserve(batch.size());
+  for (size_t i = 0; i < batch.size(); ++i)
+    order.add(std::pair<K,size_t>(batch[i].first, i));
+  order.sort();
+  // the last of each run of equal keys is the one added last
+  sorted.reserve(sorted.size() + order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    if (i + 1 == order.size() || order[i].first != order[i + 1].first)
+      sorted.add(batch[order[i].second]);
+  }
+}
+
+
+
+template<typename K, typename V>
+template<typename Node>
+Node** Collection<K,V>::merge_batch(Node* root, size_t node_count,
+                                    const ArrayList<std::pair<K,V>>& batch,
+                                    size_t& count)
+{
+  ArrayList<std::pair<K,V>> sorted;
+  sort_batch(batch, sorted);
+  // line up the existing nodes in key order
+  Node** old_nodes = new Node*[node_count];
+  size_t old_count = 0;
+  flatten(root, old_nodes, old_count);
+  // merge in new nodes for the batch keys that aren't already here
+  Node** nodes = new Node*[old_count + sorted.size()];
+  count = 0;
+  size_t i = 0;
+  for (size_t j = 0; j < sorted.size(); ++j) {
+    while (i < old_count && old_nodes[i]->key < sorted[j].first)
+      nodes[count++] = old_nodes[i++];
+    if (i == old_count || old_nodes[i]->key != sorted[j].first) {
+      Node* new_node = new Node;
+      new_node->key = sorted[j].first;
+      new_node->value = sorted[j].second;
+      nodes[count++] = new_node;
+    }
+  }
+  while (i < old_count)
+    nodes[count++] = old_nodes[i++];
+  delete [] old_nodes;
+  return nodes;
+}
+
+
+template<typename K, typename V>
+template<typename Node>
+void Collection<K,V>::flatten(Node* subtree_root, Node** nodes, size_t& count)
+{
+  if (subtree_root == nullptr)
+    return;
+  flatten(subtree_root->left, nodes, count);
+  nodes[count++] = subtree_root;
+  flatten(subtree_root->right, nodes, count);
+}
+
+
 #endif
@@ -0,0 +1,328 @@
+//----------------------------------------------------------------------
+// FILE: concurrent_hash_table_collection.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a thread-safe version of the hash table collection.
+//        Buckets are grouped into a fixed number of lock stripes, where
+//        each stripe is guarded by a reader-writer lock. Finds only take
+//        a shared lock on one stripe, so readers never block each other,
+//        and adds and removes only block the stripe the key hashes to.
+//        Resizing takes every stripe exclusively before rehashing.
+//----------------------------------------------------------------------
+
+#ifndef CONCURRENT_HASH_TABLE_COLLECTION_H
+#define CONCURRENT_HASH_TABLE_COLLECTION_H
+
+#include "collection.h"
+#include "array_list.h"
+#include <functional>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+using namespace std;
+
+template<typename K, typename V>
+class ConcurrentHashTableCollection : public Collection<K,V>
+{
+  public:
+    ConcurrentHashTableCollection();
+    ConcurrentHashTableCollection(const ConcurrentHashTableCollection<K,V>& rhs);
+    ~ConcurrentHashTableCollection();
+    ConcurrentHashTableCollection& operator=(const ConcurrentHashTableCollection<K,V>& rhs);
+
+    void add(const K& key, const V& val);
+    void remove(const K& key);
+    bool find(const K& key, V& val) const;
+    void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
+    void keys(ArrayList<K>& all_keys) const;
+    void sort(ArrayList<K>& all_keys_sorted) const;
+    size_t size() const;
+
+  private:
+    struct Node {
+      K key;
+      V value;
+      Node* next;
+    };
+    // number of lock stripes (power of two, divides the table capacity
+    // so a key maps to the same stripe before and after a resize)
+    static const size_t STRIPES = 64;
+    Node** hash_table;
+    size_t table_capacity;
+    atomic<size_t> length;
+    double load_factor_threshold = 0.75;
+    // one reader-writer lock per stripe of buckets
+    mutable shared_mutex stripe_locks[STRIPES];
+    // stripe for a given hash code
+    size_t stripe(size_t code) const;
+    // helpers to take every stripe in order (avoids deadlock)
+    void lock_all() const;
+    void unlock_all() const;
+    void lock_all_shared() const;
+    void unlock_all_shared() const;
+    // grows the table if the load factor is still exceeded
+    void resize_and_rehash();
+    void make_empty();
+};
+
+template<typename K, typename V>
+ConcurrentHashTableCollection<K,V>::ConcurrentHashTableCollection()
+  : table_capacity(STRIPES), length(0)
+{
+  hash_table = new Node*[table_capacity];
+  //make each bucket null
+  for (size_t i = 0; i < table_capacity; ++i) {
+    hash_table[i] = nullptr;
+  }
+}
+
+template<typename K, typename V>
+ConcurrentHashTableCollection<K,V>::ConcurrentHashTableCollection
+(const ConcurrentHashTableCollection<K,V>& rhs)
+  : hash_table(nullptr), table_capacity(0), length(0)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+template<typename K, typename V>
+ConcurrentHashTableCollection<K,V>::~ConcurrentHashTableCollection() {
+  make_empty();
+}
+
+template<typename K, typename V>
+ConcurrentHashTableCollection<K,V>& ConcurrentHashTableCollection<K,V>::operator=
+(const ConcurrentHashTableCollection<K,V>& rhs) {
+  if (this != &rhs) {
+    //copy rhs while it is held for reading, taking the two lock sets
+    //in address order so a = b and b = a at once can't deadlock
+    bool rhs_first = less<const void*>()(&rhs, this);
+    if (rhs_first) {
+      rhs.lock_all_shared();
+    }
+    lock_all();
+    if (!rhs_first) {
+      rhs.lock_all_shared();
+    }
+    make_empty();
+    table_capacity = rhs.table_capacity;
+    hash_table = new Node*[table_capacity];
+    for (size_t i = 0; i < table_capacity; ++i) {
+      hash_table[i] = nullptr;
+      //copy each chain, order within a chain doesn't matter
+      Node* curr = rhs.hash_table[i];
+      while (curr != nullptr) {
+        Node* new_node = new Node;
+        new_node->key = curr->key;
+        new_node->value = curr->value;
+        new_node->next = hash_table[i];
+        hash_table[i] = new_node;
+        curr = curr->next;
+      }
+    }
+    length = rhs.length.load();
+    unlock_all();
+    rhs.unlock_all_shared();
+  }
+  return *this;
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::add(const K& k, const V& val) {
+  std::hash<K> hash_fun;
+  size_t code = hash_fun(k);
+  Node* new_node = new Node;
+  new_node->key = k;
+  new_node->value = val;
+  bool grow = false;
+  {
+    //only the key's stripe is blocked while linking in the node
+    unique_lock<shared_mutex> lock(stripe_locks[stripe(code)]);
+    size_t index = code % table_capacity;
+    new_node->next = hash_table[index];
+    hash_table[index] = new_node;
+    length++;
+    grow = length * 1.0 / table_capacity >= load_factor_threshold;
+  }
+  // resize outside the stripe lock (it needs every stripe)
+  if (grow) {
+    resize_and_rehash();
+  }
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::remove(const K& k) {
+  std::hash<K> hash_fun;
+  size_t code = hash_fun(k);
+  Node* curr = nullptr;
+  {
+    unique_lock<shared_mutex> lock(stripe_locks[stripe(code)]);
+    size_t index = code % table_capacity;
+    // find key within linked list in hashed bucket
+    curr = hash_table[index];
+    Node* prev = nullptr;
+    while (curr != nullptr && curr->key != k) {
+      prev = curr;
+      curr = curr->next;
+    }
+    // make sure key was found
+    if (curr != nullptr) {
+      if (prev != nullptr) {
+        prev->next = curr->next;
+      } else {
+        hash_table[index] = curr->next;
+      }
+      length--;
+    }
+  }
+  //free the node outside of the lock
+  delete curr;
+}
+
+template<typename K, typename V>
+bool ConcurrentHashTableCollection<K,V>::find(const K& k, V& v) const {
+  std::hash<K> hash_fun;
+  size_t code = hash_fun(k);
+  //shared lock, so concurrent finds on the same stripe don't block
+  shared_lock<shared_mutex> lock(stripe_locks[stripe(code)]);
+  size_t index = code % table_capacity;
+  Node* curr = hash_table[index];
+  while (curr != nullptr && curr->key != k) {
+    curr = curr->next;
+  }
+  // see if key was found
+  if (curr != nullptr) {
+    v = curr->value;
+    return true;
+  }
+  return false;
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  lock_all_shared();
+  // search through every single node in table
+  for (size_t i = 0; i < table_capacity; ++i) {
+    Node* curr = hash_table[i];
+    while (curr != nullptr) {
+      if (curr->key >= k1 && curr->key <= k2) {
+        keys.add(curr->key);
+      }
+      curr = curr->next;
+    }
+  }
+  unlock_all_shared();
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::keys(ArrayList<K>& all_keys) const {
+  lock_all_shared();
+  // add every single node to all_keys
+  for (size_t i = 0; i < table_capacity; ++i) {
+    Node* curr = hash_table[i];
+    while (curr != nullptr) {
+      all_keys.add(curr->key);
+      curr = curr->next;
+    }
+  }
+  unlock_all_shared();
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+  //get a consistent snapshot of the keys, then sort without locks
+  keys(all_keys_sorted);
+  all_keys_sorted.sort();
+}
+
+template<typename K, typename V>
+size_t ConcurrentHashTableCollection<K,V>::size() const {
+  return length;
+}
+
+template<typename K, typename V>
+size_t ConcurrentHashTableCollection<K,V>::stripe(size_t code) const {
+  return code % STRIPES;
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::lock_all() const {
+  for (size_t i = 0; i < STRIPES; ++i) {
+    stripe_locks[i].lock();
+  }
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::unlock_all() const {
+  for (size_t i = STRIPES; i > 0; --i) {
+    stripe_locks[i - 1].unlock();
+  }
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::lock_all_shared() const {
+  for (size_t i = 0; i < STRIPES; ++i) {
+    stripe_locks[i].lock_shared();
+  }
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::unlock_all_shared() const {
+  for (size_t i = STRIPES; i > 0; --i) {
+    stripe_locks[i - 1].unlock_shared();
+  }
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::resize_and_rehash() {
+  lock_all();
+  //another thread may have already resized while we waited
+  if (length * 1.0 / table_capacity < load_factor_threshold) {
+    unlock_all();
+    return;
+  }
+  size_t new_capacity = 2 * table_capacity;
+  Node** copy = new Node*[new_capacity];
+  for (size_t i = 0; i < new_capacity; ++i) {
+    copy[i] = nullptr;
+  }
+  std::hash<K> hash_fun;
+  //go through each node and rehash it into new array
+  for (size_t i = 0; i < table_capacity; ++i) {
+    Node* curr = hash_table[i];
+    while (curr != nullptr) {
+      size_t index = hash_fun(curr->key) % new_capacity;
+      Node* temp = curr->next;
+      curr->next = copy[index];
+      copy[index] = curr;
+      curr = temp;
+    }
+  }
+  delete [] hash_table;
+  hash_table = copy;
+  table_capacity = new_capacity;
+  unlock_all();
+}
+
+template<typename K, typename V>
+void ConcurrentHashTableCollection<K,V>::make_empty() {
+  if (hash_table != nullptr) {
+    // delete linked list at each bucket
+    for (size_t i = 0; i < table_capacity; ++i) {
+      Node* curr = hash_table[i];
+      while (curr != nullptr) {
+        Node* next_node = curr->next;
+        delete curr;
+        curr = next_node;
+      }
+    }
+    // delete array
+    delete [] hash_table;
+    hash_table = nullptr;
+    length = 0;
+    table_capacity = 0;
+  }
+}
+
+#endif
@@ -0,0 +1,369 @@
+//----------------------------------------------------------------------
+// FILE: cuckoo_hash_collection.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a version of the collection class using bucketized
+//        cuckoo hashing. Each key has exactly two candidate buckets of
+//        SLOTS entries each, so a lookup probes at most two buckets
+//        (plus a small stash that is only checked when non-empty).
+//        Adds displace existing keys to their alternate bucket when
+//        both candidates are full. If displacement fails, the homeless
+//        key goes into the stash, and if the stash is full the table
+//        is doubled and rehashed.
+//----------------------------------------------------------------------
+
+#ifndef CUCKOO_HASH_COLLECTION_H
+#define CUCKOO_HASH_COLLECTION_H
+
+#include "collection.h"
+#include "array_list.h"
+#include <functional>
+
+using namespace std;
+
+template<typename K, typename V>
+class CuckooHashCollection : public Collection<K,V>
+{
+  public:
+    CuckooHashCollection();
+    CuckooHashCollection(const CuckooHashCollection<K,V>& rhs);
+    ~CuckooHashCollection();
+    CuckooHashCollection& operator=(const CuckooHashCollection<K,V>& rhs);
+
+    void add(const K& key, const V& val);
+    void remove(const K& key);
+    bool find(const K& key, V& val) const;
+    void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
+    void keys(ArrayList<K>& all_keys) const;
+    void sort(ArrayList<K>& all_keys_sorted) const;
+    size_t size() const;
+    // number of keys currently held in the stash
+    size_t stash_size() const;
+
+  private:
+    // entries per bucket, keys are kept together so a bucket probe
+    // touches as few cache lines as possible
+    static const size_t SLOTS = 4;
+    // maximum number of keys that couldn't be placed in a bucket
+    static const size_t STASH_CAPACITY = 8;
+    // displacements to try before giving up on an add
+    static const size_t MAX_KICKS = 500;
+    // cache-line aligned (new[] uses the aligned operator new), so a
+    // bucket of small keys and values is a single line
+    struct alignas(64) Bucket {
+      K keys[SLOTS];
+      V values[SLOTS];
+      // bit i is set if slot i is in use
+      unsigned char used;
+    };
+    Bucket* buckets;
+    // number of buckets (power of two)
+    size_t bucket_count;
+    size_t length;
+    K stash_keys[STASH_CAPACITY];
+    V stash_values[STASH_CAPACITY];
+    size_t stash_count;
+    // state for choosing which entry to displace
+    size_t kick_state;
+    double load_factor_threshold = 0.9;
+    // the two candidate buckets for a key
+    void bucket_indexes(const K& key, size_t& b1, size_t& b2) const;
+    // put the key in a free slot of the bucket if there is one
+    bool place_in_bucket(size_t b, const K& key, const V& val);
+    // place a key, displacing others as needed. If this fails, key and
+    // val hold whichever entry is left without a slot.
+    bool place(K& key, V& val);
+    // grow the table to (at least) new_count buckets and reinsert
+    void rehash(size_t new_count);
+    void make_empty();
+};
+
+template<typename K, typename V>
+CuckooHashCollection<K,V>::CuckooHashCollection()
+  : bucket_count(16), length(0), stash_count(0), kick_state(0)
+{
+  buckets = new Bucket[bucket_count];
+  for (size_t i = 0; i < bucket_count; ++i) {
+    buckets[i].used = 0;
+  }
+}
+
+template<typename K, typename V>
+CuckooHashCollection<K,V>::CuckooHashCollection(const CuckooHashCollection<K,V>& rhs)
+  : buckets(nullptr), bucket_count(0), length(0), stash_count(0), kick_state(0)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+template<typename K, typename V>
+CuckooHashCollection<K,V>::~CuckooHashCollection() {
+  make_empty();
+}
+
+template<typename K, typename V>
+CuckooHashCollection<K,V>& CuckooHashCollection<K,V>::operator=
+(const CuckooHashCollection<K,V>& rhs) {
+  if (this != &rhs) {
+    make_empty();
+    bucket_count = rhs.bucket_count;
+    buckets = new Bucket[bucket_count];
+    //buckets are copied as-is, so every key keeps its slot
+    for (size_t i = 0; i < bucket_count; ++i) {
+      buckets[i] = rhs.buckets[i];
+    }
+    for (size_t i = 0; i < rhs.stash_count; ++i) {
+      stash_keys[i] = rhs.stash_keys[i];
+      stash_values[i] = rhs.stash_values[i];
+    }
+    stash_count = rhs.stash_count;
+    length = rhs.length;
+  }
+  return *this;
+}
+
+template<typename K, typename V>
+void CuckooHashCollection<K,V>::add(const K& k, const V& val) {
+  // check to see if table needs to be resized
+  if (length * 1.0 / (bucket_count * SLOTS) >= load_factor_threshold) {
+    rehash(2 * bucket_count);
+  }
+  K key = k;
+  V value = val;
+  // keep growing until the leftover entry finds a home
+  while (!place(key, value)) {
+    rehash(2 * bucket_count);
+  }
+  length = length + 1;
+}
+
+template<typename K, typename V>
+void CuckooHashCollection<K,V>::remove(const K& k) {
+  size_t b1, b2;
+  bucket_indexes(k, b1, b2);
+  size_t candidates[2] = {b1, b2};
+  //check both buckets
+  for (size_t c = 0; c < 2; ++c) {
+    Bucket& b = buckets[candidates[c]];
+    for (size_t i = 0; i < SLOTS; ++i) {
+      if ((b.used & (1 << i)) && b.keys[i] == k) {
+        b.used &= ~(1 << i);
+        length = length - 1;
+        return;
+      }
+    }
+  }
+  //check the stash, filling the hole with the last stashed entry
+  for (size_t i = 0; i < stash_count; ++i) {
+    if (stash_keys[i] == k) {
+      stash_count = stash_count - 1;
+      stash_keys[i] = stash_keys[stash_count];
+      stash_values[i] = stash_values[stash_count];
+      length = length - 1;
+      return;
+    }
+  }
+}
+
+template<typename K, typename V>
+bool CuckooHashCollection<K,V>::find(const K& k, V& v) const {
+  size_t b1, b2;
+  bucket_indexes(k, b1, b2);
+  //first candidate bucket
+  const Bucket& first = buckets[b1];
+  for (size_t i = 0; i < SLOTS; ++i) {
+    if ((first.used & (1 << i)) && first.keys[i] == k) {
+      v = first.values[i];
+      return true;
+    }
+  }
+  //second candidate bucket
+  const Bucket& second = buckets[b2];
+  for (size_t i = 0; i < SLOTS; ++i) {
+    if ((second.used & (1 << i)) && second.keys[i] == k) {
+      v = second.values[i];
+      return true;
+    }
+  }
+  //stash is almost always empty
+  for (size_t i = 0; i < stash_count; ++i) {
+    if (stash_keys[i] == k) {
+      v = stash_values[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename K, typename V>
+void CuckooHashCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  // search through every single slot in the table
+  for (size_t b = 0; b < bucket_count; ++b) {
+    for (size_t i = 0; i < SLOTS; ++i) {
+      const K& key = buckets[b].keys[i];
+      if ((buckets[b].used & (1 << i)) && key >= k1 && key <= k2) {
+        keys.add(key);
+      }
+    }
+  }
+  for (size_t i = 0; i < stash_count; ++i) {
+    if (stash_keys[i] >= k1 && stash_keys[i] <= k2) {
+      keys.add(stash_keys[i]);
+    }
+  }
+}
+
+template<typename K, typename V>
+void CuckooHashCollection<K,V>::keys(ArrayList<K>& all_keys) const {
+  for (size_t b = 0; b < bucket_count; ++b) {
+    for (size_t i = 0; i < SLOTS; ++i) {
+      if (buckets[b].used & (1 << i)) {
+        all_keys.add(buckets[b].keys[i]);
+      }
+    }
+  }
+  for (size_t i = 0; i < stash_count; ++i) {
+    all_keys.add(stash_keys[i]);
+  }
+}
+
+template<typename K, typename V>
+void CuckooHashCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+  //get all keys
+  keys(all_keys_sorted);
+  //sort resulting array
+  all_keys_sorted.sort();
+}
+
+template<typename K, typename V>
+size_t CuckooHashCollection<K,V>::size() const {
+  return length;
+}
+
+template<typename K, typename V>
+size_t CuckooHashCollection<K,V>::stash_size() const {
+  return stash_count;
+}
+
+template<typename K, typename V>
+void CuckooHashCollection<K,V>::bucket_indexes(const K& key, size_t& b1, size_t& b2) const {
+  std::hash<K> hash_fun;
+  unsigned long long code = hash_fun(key);
+  //mix the bits so keys with weak hashes (e.g. ints) still spread out
+  code ^= code >> 33;
+  code *= 0xff51afd7ed558ccdull;
+  code ^= code >> 33;
+  code *= 0xc4ceb9fe1a85ec53ull;
+  code ^= code >> 33;
+  size_t mask = bucket_count - 1;
+  b1 = code & mask;
+  b2 = (code >> 32) & mask;
+  //make sure the two candidates are different buckets
+  if (b1 == b2) {
+    b2 = b1 ^ 1;
+  }
+}
+
+template<typename K, typename V>
+bool CuckooHashCollection<K,V>::place_in_bucket(size_t b, const K& key, const V& val) {
+  Bucket& bucket = buckets[b];
+  for (size_t i = 0; i < SLOTS; ++i) {
+    if (!(bucket.used & (1 << i))) {
+      bucket.keys[i] = key;
+      bucket.values[i] = val;
+      bucket.used |= (1 << i);
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename K, typename V>
+bool CuckooHashCollection<K,V>::place(K& key, V& val) {
+  size_t b1, b2;
+  bucket_indexes(key, b1, b2);
+  if (place_in_bucket(b1, key, val) || place_in_bucket(b2, key, val)) {
+    return true;
+  }
+  //both buckets full, start displacing entries
+  size_t b = b1;
+  for (size_t kicks = 0; kicks < MAX_KICKS; ++kicks) {
+    //pick a pseudo-random victim slot
+    kick_state = kick_state * 6364136223846793005ull + 1442695040888963407ull;
+    size_t slot = (kick_state >> 33) % SLOTS;
+    Bucket& bucket = buckets[b];
+    std::swap(key, bucket.keys[slot]);
+    std::swap(val, bucket.values[slot]);
+    //move the victim to its other bucket
+    bucket_indexes(key, b1, b2);
+    b = (b1 == b) ? b2 : b1;
+    if (place_in_bucket(b, key, val)) {
+      return true;
+    }
+  }
+  //no room found, fall back to the stash
+  if (stash_count < STASH_CAPACITY) {
+    stash_keys[stash_count] = key;
+    stash_values[stash_count] = val;
+    stash_count = stash_count + 1;
+    return true;
+  }
+  return false;
+}
+
+template<typename K, typename V>
+void CuckooHashCollection<K,V>::rehash(size_t new_count) {
+  Bucket* old_buckets = buckets;
+  size_t old_count = bucket_count;
+  K old_stash_keys[STASH_CAPACITY];
+  V old_stash_values[STASH_CAPACITY];
+  size_t old_stash_count = stash_count;
+  for (size_t i = 0; i < stash_count; ++i) {
+    old_stash_keys[i] = stash_keys[i];
+    old_stash_values[i] = stash_values[i];
+  }
+  bool placed = false;
+  while (!placed) {
+    buckets = new Bucket[new_count];
+    bucket_count = new_count;
+    stash_count = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+      buckets[i].used = 0;
+    }
+    placed = true;
+    //reinsert from the old table, which is left untouched so the
+    //rehash can start over at a larger size if a key can't be placed
+    for (size_t b = 0; b < old_count && placed; ++b) {
+      for (size_t i = 0; i < SLOTS && placed; ++i) {
+        if (old_buckets[b].used & (1 << i)) {
+          K key = old_buckets[b].keys[i];
+          V val = old_buckets[b].values[i];
+          placed = place(key, val);
+        }
+      }
+    }
+    for (size_t i = 0; i < old_stash_count && placed; ++i) {
+      K key = old_stash_keys[i];
+      V val = old_stash_values[i];
+      placed = place(key, val);
+    }
+    if (!placed) {
+      delete [] buckets;
+      new_count = 2 * new_count;
+    }
+  }
+  delete [] old_buckets;
+}
+
+template<typename K, typename V>
+void CuckooHashCollection<K,V>::make_empty() {
+  if (buckets != nullptr) {
+    delete [] buckets;
+    buckets = nullptr;
+  }
+  bucket_count = 0;
+  stash_count = 0;
+  length = 0;
+}
+
+#endif
@@ -0,0 +1,211 @@
+//----------------------------------------------------------------------
+// FILE: eytzinger_collection.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a read-only version of the collection class built
+//        from any other collection. Keys are stored in Eytzinger
+//        (breadth-first) order: the root at index 1 and the children
+//        of index i at 2i and 2i+1. A search reads keys near the front
+//        of the array first, so the top levels stay cached, and the
+//        descendants a few levels down sit in one contiguous block that
+//        can be prefetched. The loop has no data-dependent branch.
+//        Values are kept in a separate array in the same order, so
+//        searches only read keys. Adds and removes are ignored.
+//----------------------------------------------------------------------
+
+#ifndef EYTZINGER_COLLECTION_H
+#define EYTZINGER_COLLECTION_H
+
+#include "collection.h"
+#include "array_list.h"
+
+using namespace std;
+
+template<typename K, typename V>
+class EytzingerCollection : public Collection<K,V>
+{
+  public:
+    // build from every key-value pair in source
+    EytzingerCollection(const Collection<K,V>& source);
+    EytzingerCollection(const EytzingerCollection<K,V>& rhs);
+    ~EytzingerCollection();
+    EytzingerCollection& operator=(const EytzingerCollection<K,V>& rhs);
+
+    // read-only: adds and removes leave the collection unchanged
+    void add(const K& key, const V& val);
+    void remove(const K& key);
+    bool find(const K& key, V& val) const;
+    void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
+    void keys(ArrayList<K>& all_keys) const;
+    void sort(ArrayList<K>& all_keys_sorted) const;
+    size_t size() const;
+
+  private:
+    // keys[1..length] in Eytzinger order (keys[0] is unused)
+    K* keys_array;
+    // values[i] belongs to keys[i]
+    V* values;
+    size_t length;
+    // index of the first key >= key, or 0 if there is none
+    size_t lower_bound(const K& key) const;
+    // index of the next key in sorted order, or 0 after the last key
+    size_t successor(size_t i) const;
+    // place sorted[j...] at index i and its subtree (in-order)
+    void build(const ArrayList<std::pair<K,V>>& sorted, size_t& j, size_t i);
+    void make_empty();
+};
+
+template<typename K, typename V>
+EytzingerCollection<K,V>::EytzingerCollection(const Collection<K,V>& source)
+  : length(0)
+{
+  //every pair in one pass (rather than a find per key), by key
+  ArrayList<std::pair<K,V>> all_pairs;
+  source.pairs(all_pairs);
+  ArrayList<std::pair<K,V>> sorted;
+  this->sort_batch(all_pairs, sorted);
+  length = sorted.size();
+  keys_array = new K[length + 1];
+  values = new V[length + 1];
+  size_t j = 0;
+  build(sorted, j, 1);
+}
+
+template<typename K, typename V>
+EytzingerCollection<K,V>::EytzingerCollection(const EytzingerCollection<K,V>& rhs)
+  : keys_array(nullptr), values(nullptr), length(0)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+template<typename K, typename V>
+EytzingerCollection<K,V>::~EytzingerCollection() {
+  make_empty();
+}
+
+template<typename K, typename V>
+EytzingerCollection<K,V>& EytzingerCollection<K,V>::operator=
+(const EytzingerCollection<K,V>& rhs) {
+  if (this != &rhs) {
+    make_empty();
+    length = rhs.length;
+    keys_array = new K[length + 1];
+    values = new V[length + 1];
+    for (size_t i = 1; i <= length; ++i) {
+      keys_array[i] = rhs.keys_array[i];
+      values[i] = rhs.values[i];
+    }
+  }
+  return *this;
+}
+
+template<typename K, typename V>
+void EytzingerCollection<K,V>::add(const K&, const V&) {
+  // collection is frozen
+}
+
+template<typename K, typename V>
+void EytzingerCollection<K,V>::remove(const K&) {
+  // collection is frozen
+}
+
+template<typename K, typename V>
+bool EytzingerCollection<K,V>::find(const K& key, V& val) const {
+  size_t i = lower_bound(key);
+  if (i != 0 && keys_array[i] == key) {
+    val = values[i];
+    return true;
+  }
+  return false;
+}
+
+template<typename K, typename V>
+void EytzingerCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  //walk the in-order successors starting at the first key >= k1
+  for (size_t i = lower_bound(k1); i != 0 && keys_array[i] <= k2; i = successor(i)) {
+    keys.add(keys_array[i]);
+  }
+}
+
+template<typename K, typename V>
+void EytzingerCollection<K,V>::keys(ArrayList<K>& all_keys) const {
+  //keys come back in storage (breadth-first) order
+  for (size_t i = 1; i <= length; ++i) {
+    all_keys.add(keys_array[i]);
+  }
+}
+
+template<typename K, typename V>
+void EytzingerCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+  if (length == 0) {
+    return;
+  }
+  //start at the leftmost node and follow successors
+  size_t i = 1;
+  while (2 * i <= length) {
+    i = 2 * i;
+  }
+  for (; i != 0; i = successor(i)) {
+    all_keys_sorted.add(keys_array[i]);
+  }
+}
+
+template<typename K, typename V>
+size_t EytzingerCollection<K,V>::size() const {
+  return length;
+}
+
+template<typename K, typename V>
+size_t EytzingerCollection<K,V>::lower_bound(const K& key) const {
+  size_t i = 1;
+  while (i <= length) {
+    //the 16 descendants four levels down are contiguous
+    __builtin_prefetch(keys_array + 16 * i);
+    //go right if keys[i] < key, without a branch
+    i = 2 * i + (keys_array[i] < key);
+  }
+  //undo the final run of right turns plus one left turn, which leaves
+  //the last node where the search went left (0 if it never did)
+  i >>= __builtin_ffsll(~i);
+  return i;
+}
+
+template<typename K, typename V>
+size_t EytzingerCollection<K,V>::successor(size_t i) const {
+  //leftmost node of the right subtree
+  if (2 * i + 1 <= length) {
+    i = 2 * i + 1;
+    while (2 * i <= length) {
+      i = 2 * i;
+    }
+    return i;
+  }
+  //otherwise the nearest ancestor we are to the left of
+  return i >> __builtin_ffsll(~i);
+}
+
+template<typename K, typename V>
+void EytzingerCollection<K,V>::build(const ArrayList<std::pair<K,V>>& sorted,
+size_t& j, size_t i) {
+  if (i > length) {
+    return;
+  }
+  //in-order: left subtree, this node, right subtree
+  build(sorted, j, 2 * i);
+  keys_array[i] = sorted[j].first;
+  values[i] = sorted[j].second;
+  j++;
+  build(sorted, j, 2 * i + 1);
+}
+
+template<typename K, typename V>
+void EytzingerCollection<K,V>::make_empty() {
+  delete [] keys_array;
+  delete [] values;
+  keys_array = nullptr;
+  values = nullptr;
+  length = 0;
+}
+
+#endif
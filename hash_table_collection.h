@@ -12,11 +12,37 @@
 
 #include "collection.h"
 #include "array_list.h"
+#include "value_holder.h"
 #include <functional>
 #include <iostream>
 
 using namespace std;
 
+// hash table statistics, gathered in a single pass over the table
+struct HashTableStats {
+  size_t bucket_count = 0;
+  size_t empty_buckets = 0;
+  // shortest and longest non-empty chain
+  size_t min_chain_length = 0;
+  size_t max_chain_length = 0;
+  // average length of the non-empty chains
+  double avg_chain_length = 0;
+  // chain_histogram[i] = number of buckets with a chain of length i
+  // (also the number of buckets where a missing key is rejected after
+  // comparing i keys)
+  ArrayList<size_t> chain_histogram;
+  // successful_probes[i] = number of keys found after comparing i keys
+  ArrayList<size_t> successful_probes;
+  // expected key comparisons for a find of a present key, and for a
+  // find of a missing key (assuming it hashes to a uniform bucket)
+  double avg_successful_probes = 0;
+  double avg_failed_probes = 0;
+  // number of times the table has grown
+  size_t resize_count = 0;
+  // bytes held by the table array and nodes (excluding allocator overhead)
+  size_t bytes_used = 0;
+};
+
 template<typename K, typename V>
 class HashTableCollection : public Collection<K,V> 
 {
@@ -32,21 +58,25 @@ class HashTableCollection : public Collection<K,V>
     void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
     void keys(ArrayList<K>& all_keys) const;
     void sort(ArrayList<K>& all_keys_sorted) const;
+    // as above, sorting the keys with up to thread_count threads
+    void sort(ArrayList<K>& all_keys_sorted, size_t thread_count) const;
     size_t size() const;
     size_t min_chain_length();
     size_t max_chain_length();
     double avg_chain_length();
+    void statistics(HashTableStats& stats) const;
 		
   private:
-    struct Node {
+    // value comes from ValueHolder (and takes no space for empty V)
+    struct Node : ValueHolder<V> {
       K key;
-      V value;
       Node* next;
     };
     Node** hash_table;
     size_t length;
     size_t table_capacity;
     double load_factor_threshold = 0.75;
+    size_t resize_count = 0;
     void resize_and_rehash(); 
     void make_empty();
 };
@@ -203,6 +233,12 @@ void HashTableCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
   all_keys_sorted.sort();
 }
 
+template<typename K, typename V>
+void HashTableCollection<K,V>::sort(ArrayList<K>& all_keys_sorted, size_t thread_count) const {
+  keys(all_keys_sorted);
+  all_keys_sorted.sort(thread_count);
+}
+
 template<typename K, typename V>
 size_t HashTableCollection<K,V>::size() const {
   return length;
@@ -210,75 +246,72 @@ size_t HashTableCollection<K,V>::size() const {
 
 template<typename K, typename V>
 size_t HashTableCollection<K,V>::min_chain_length() {
-  // if list is empty, longest chain is zero
-  if (length == 0) {
-  	return 0;
-  }
-  size_t count = 0;
-  size_t min = 0;
-  Node* curr = nullptr;
-  // count nodes at each bucket
-  for (size_t i = 0; i < table_capacity; ++i) {
-    curr = hash_table[i];
-    while (curr != nullptr) {
-      count++;
-      curr = curr->next;
-    }
-    // if new minimum is found, update min
-    if (min == 0 || min > count) {
-      min = count;
-    }
-    //reset count for next bucket
-    count = 0;
-  }
-  return min;
+  HashTableStats stats;
+  statistics(stats);
+  return stats.min_chain_length;
 }
 
 template<typename K, typename V>
 size_t HashTableCollection<K,V>::max_chain_length() {
-  // if list is empty, longest chain is zero
-  if (length == 0) {
-  	return 0;
-  }
-  size_t count = 0;
-  size_t max = 0;
-  Node* curr = nullptr;
-  // count nodes at each bucket
-  for (size_t i = 0; i < table_capacity; ++i) {
-    curr = hash_table[i];
-    while (curr != nullptr) {
-      count++;
-      curr = curr->next;
-    }
-    // if a new max is found, update max
-    if (max < count) {
-      max = count;
-    }
-    // reset count
-    count = 0;
-  }
-  return max;
+  HashTableStats stats;
+  statistics(stats);
+  return stats.max_chain_length;
 }
 
 template<typename K, typename V>
 double HashTableCollection<K,V>::avg_chain_length() {
-  // if list is empty, no chains to count
-  if (length == 0) {
-  	return 0;
-  }
-  size_t count = 0;
-  size_t sum;
+  HashTableStats stats;
+  statistics(stats);
+  return stats.avg_chain_length;
+}
+
+template<typename K, typename V>
+void HashTableCollection<K,V>::statistics(HashTableStats& stats) const {
+  stats.bucket_count = table_capacity;
+  stats.resize_count = resize_count;
+  stats.bytes_used = sizeof(*this) + table_capacity * sizeof(Node*) + length * sizeof(Node);
+  size_t non_empty = 0;
+  size_t probe_sum = 0;
   Node* curr = nullptr;
-  //keep a continual count through every bucket
+  // walk every chain once, counting its length as we go
   for (size_t i = 0; i < table_capacity; ++i) {
+    size_t count = 0;
     curr = hash_table[i];
     while (curr != nullptr) {
       count++;
+      // the count-th key in a chain is found after count comparisons
+      while (stats.successful_probes.size() <= count) {
+        stats.successful_probes.add(0);
+      }
+      stats.successful_probes[count]++;
+      probe_sum += count;
       curr = curr->next;
     }
+    while (stats.chain_histogram.size() <= count) {
+      stats.chain_histogram.add(0);
+    }
+    stats.chain_histogram[count]++;
+    // update min and max over non-empty chains
+    if (count == 0) {
+      stats.empty_buckets++;
+    } else {
+      if (non_empty == 0 || count < stats.min_chain_length) {
+        stats.min_chain_length = count;
+      }
+      if (count > stats.max_chain_length) {
+        stats.max_chain_length = count;
+      }
+      non_empty++;
+    }
+  }
+  // compute the averages
+  if (non_empty > 0) {
+    stats.avg_chain_length = length * 1.0 / non_empty;
+    stats.avg_successful_probes = probe_sum * 1.0 / length;
+  }
+  if (table_capacity > 0) {
+    stats.avg_failed_probes = length * 1.0 / table_capacity;
   }
-  // compute and return the average
-  return count * 1.0 / table_capacity;
 }
 
 template<typename K, typename V>
@@ -307,10 +340,12 @@ void HashTableCollection<K,V>::resize_and_rehash() {
   //hold the length
   size_t l = length;
   //set hash table to copy array
+  delete [] hash_table;
   hash_table = copy;
   length = l;
   copy = nullptr;
   table_capacity = 2 * table_capacity;
+  resize_count++;
 }
 
 template<typename K, typename V>
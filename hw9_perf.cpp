@@ -12,9 +12,36 @@
 //     4 = find range
 //     5 = sort
 //     6 = statistics
+//     7 = multithreaded hash table throughput
+//     8 = worst-case hash table find latency
+//     9 = mixed point and range queries
+//    10 = hash table statistics
+//    11 = keys after draining 90% of a hash table
+//    12 = perfect hash build and find value
+//    13 = cache hit ratio and throughput on a Zipfian workload
+//    14 = binary search vs Eytzinger layout find value (int keys)
+//    15 = binary search find value and find range, narrow vs wide values
+//    16 = load time by batch size (add_batch)
+//    17 = binary search collection find value by search policy
+//    18 = binary search collection find range: copy vs slice vs count
+//    19 = memory per entry with int values vs no values (key-only sets)
+//    20 = ArrayList quick sort vs intro sort on sorted, reversed,
+//         duplicate-heavy, and random input
+//    21 = ArrayList merge sort vs intro sort on large random lists
+//    22 = multi-threaded sort time for 1 up to all available cores
+//    23 = ArrayList radix sort vs comparison sorts on int and string keys
+//    24 = array-backed collection add and remove (ArrayList storage)
+//    25 = ArrayList scans by copying get vs by reference
+//    26 = small range finds into an ArrayList vs a SmallArrayList
+//    27 = append latency percentiles, ArrayList vs SegmentedList
+//    28 = linked list collection find value, find range, sort and remove
+//    29 = traversal and insert for linked, unrolled linked, and array lists
 // Output consists of average operation times for different sized
 // input lists for both implementations, except for test 6, which
-// prints statistics information.
+// prints statistics information, test 7, which prints throughput
+// for 1 up to all available cores, and test 8, which prints per-find
+// latency percentiles, and test 10, which prints hash table chain
+// and probe statistics.
 //----------------------------------------------------------------------
 
 
@@ -25,6 +52,9 @@
 #include <chrono>
 #include <string>
 #include <cassert>
+#include <thread>
+#include <mutex>
+#include <algorithm>
 #include "collection.h"
 #include "array_list_collection.h"
 #include "linked_list_collection.h"
@@ -33,6 +63,21 @@
 #include "bst_collection.h"
 #include "avl_collection.h"
 #include "rbt_collection.h"
+#include "concurrent_hash_table_collection.h"
+#include "cuckoo_hash_collection.h"
+#include "hybrid_collection.h"
+#include "linked_hash_collection.h"
+#include "perfect_hash_collection.h"
+#include "cache_collection.h"
+#include "btree_collection.h"
+#include "eytzinger_collection.h"
+#include "pma_collection.h"
+#include "small_array_list.h"
+#include "segmented_list.h"
+#include "linked_list.h"
+#include "unrolled_linked_list.h"
+#include <cmath>
+#include <malloc.h>
 
 using namespace std;
 using namespace std::chrono;
@@ -49,6 +94,28 @@ const int HASHTABLE = 3;
 const int BINSEARCHTREE = 4;
 const int AVLSEARCHTREE = 5;
 const int RBTSEARCHTREE = 6;
+const int CONCURRENTHASHTABLE = 7;
+const int CUCKOOHASHTABLE = 8;
+const int HYBRID = 9;
+const int LINKEDHASHTABLE = 10;
+const int BTREE = 11;
+const int PMA = 12;
+
+// Sort input orders and algorithms
+const int SORTED_INPUT = 0;
+const int REVERSED_INPUT = 1;
+const int DUPLICATE_INPUT = 2;
+const int RANDOM_INPUT = 3;
+const int QUICKSORT = 0;
+const int INTROSORT = 1;
+const int MERGESORT = 2;
+const int RADIXSORT = 3;
+
+// ArrayList scan methods
+const int GET_SCAN = 0;
+const int INDEX_SCAN = 1;
+const int RANGE_FOR_SCAN = 2;
+const int VIEW_SCAN = 3;
 
 // Helper functions: 
 unsigned long sum(unsigned long array[], size_t n);
@@ -63,6 +130,56 @@ double find_value(pair<string,int> array[], size_t size, int type);
 double find_range(pair<string,int> array[], size_t size, int type);
 double sort(pair<string,int> array[], size_t size, int type);
 size_t stats(pair<string,int> array[], size_t size, int type);
+double throughput(pair<string,int> array[], size_t size, size_t threads, int type);
+void find_latency(pair<string,int> array[], size_t size, int type,
+                  double& avg, unsigned long& p999, unsigned long& max);
+double mixed_queries(pair<string,int> array[], size_t size, int type);
+void hash_stats(pair<string,int> array[], size_t size, HashTableStats& stats);
+double drained_keys(pair<string,int> array[], size_t size, int type);
+void frozen(pair<string,int> array[], size_t size, double& build1, double& build2,
+            double& find1, double& find2);
+void zipf_cache(pair<string,int> array[], size_t keys, size_t capacity, bool clock,
+                double& ratio, double& ops);
+void eytzinger_find(size_t size, double& find1, double& find2);
+template<typename V>
+void value_width(size_t size, double& find, double& range);
+double batch_load(pair<string,int> array[], size_t size, size_t batch_size, int type);
+template<typename Search>
+double policy_find(size_t size);
+void slice_range(size_t size, double& copy, double& slice, double& count);
+template<typename V>
+double bytes_per_entry(size_t size, int type);
+template<typename Search>
+double policy_find(pair<string,int> array[], size_t size);
+template<typename T>
+double list_sort(size_t size, int order, int algorithm);
+template<typename T>
+T sort_item(unsigned long n);
+double threaded_sort(size_t size, size_t threads, int type);
+double key_sort(pair<string,int> array[], size_t size, int algorithm);
+template<typename K>
+void add_remove(pair<string,int> array[], size_t size, int type,
+                double& add_time, double& remove_time);
+double list_scan(pair<string,int> array[], size_t size, int method);
+template<typename K, typename Result>
+double small_range(const BinSearchCollection<K,int>& collection,
+                   const ArrayList<K>& sorted_keys, size_t width);
+template<typename ListType>
+void append_latency(size_t size, double& avg, unsigned long& p50,
+                    unsigned long& p99, unsigned long& p9999, unsigned long& max);
+void linked_list_scans(pair<string,int> array[], size_t size, double& find1,
+                       double& find2, double& sort_time, double& remove_time);
+template<typename ListType>
+void traverse_insert(size_t size, double& traverse_time, double& insert_time);
+
+// A value type filling a cache line (ordered by value so it can be
+// stored in an ArrayList)
+struct WideValue {
+  int value;
+  char padding[60];
+  bool operator<(const WideValue& rhs) const {return value < rhs.value;}
+  bool operator>(const WideValue& rhs) const {return value > rhs.value;}
+};
 
 
 // Test driver:
@@ -71,7 +188,7 @@ int main(int argc, char* argv[])
 
   // check command line args
   if (argc != 2) {
-    cerr << "usage: " << argv[0] << " test-number (1-6)" << endl;
+    cerr << "usage: " << argv[0] << " test-number (1-29)" << endl;
     exit(1);
   }
   string test_number = argv[1];
@@ -98,6 +215,8 @@ int main(int argc, char* argv[])
          << "# Column 6 = Avg time for BSTCollection add function\n"
          << "# Column 7 = Avg time for AVLCollection add function\n"
          << "# Column 8 = Avg time for RBTCollection add function\n"
+         << "# Column 9 = Avg time for BTreeCollection add function\n"
+         << "# Column 10 = Avg time for PMACollection add function\n"
          << "# All times are measured in milliseconds" << endl;
     int i = 0;
     for (size_t size = START; size <= STOP; size += STEP) {
@@ -108,6 +227,8 @@ int main(int argc, char* argv[])
       double avg5 = add(array, size, BINSEARCHTREE);
       double avg6 = add(array, size, AVLSEARCHTREE);
       double avg7 = add(array, size, RBTSEARCHTREE);
+      double avg8 = add(array, size, BTREE);
+      double avg9 = add(array, size, PMA);
       cout << size << " "
            << (avg1/1000.0) << " "
            << (avg2/1000.0) << " "
@@ -115,7 +236,9 @@ int main(int argc, char* argv[])
            << (avg4/1000.0) << " "
            << (avg5/1000.0) << " "
            << (avg6/1000.0) << " "
-           << (avg7/1000.0) << endl;
+           << (avg7/1000.0) << " "
+           << (avg8/1000.0) << " "
+           << (avg9/1000.0) << endl;
     }
   }
   // test 2: remove operation
@@ -128,6 +251,8 @@ int main(int argc, char* argv[])
          << "# Column 6 = Avg time for BSTCollection add function\n"
          << "# Column 7 = Avg time for AVLCollection add function\n"
          << "# Column 8 = Avg time for RBTCollection add function\n"
+         << "# Column 9 = Avg time for BTreeCollection add function\n"
+         << "# Column 10 = Avg time for PMACollection add function\n"
          << "# All times are measured in milliseconds" << endl;
     int i = 0;
     for (size_t size = START; size <= STOP; size += STEP) {
@@ -138,6 +263,8 @@ int main(int argc, char* argv[])
       double avg5 = remove(array, size, BINSEARCHTREE);
       double avg6 = remove(array, size, AVLSEARCHTREE);
       double avg7 = remove(array, size, RBTSEARCHTREE);
+      double avg8 = remove(array, size, BTREE);
+      double avg9 = remove(array, size, PMA);
       cout << size << " "
            << (avg1/1000.0) << " "
            << (avg2/1000.0) << " "
@@ -145,7 +272,9 @@ int main(int argc, char* argv[])
            << (avg4/1000.0) << " "
            << (avg5/1000.0) << " "
            << (avg6/1000.0) << " "
-           << (avg7/1000.0) << endl;
+           << (avg7/1000.0) << " "
+           << (avg8/1000.0) << " "
+           << (avg9/1000.0) << endl;
     }
   }
   // test 3: find-value operation
@@ -161,6 +290,8 @@ int main(int argc, char* argv[])
          << "# Column 6 = Avg time for BSTCollection add function\n"
          << "# Column 7 = Avg time for AVLCollection add function\n"
          << "# Column 8 = Avg time for RBTCollection add function\n"
+         << "# Column 9 = Avg time for BTreeCollection add function\n"
+         << "# Column 10 = Avg time for PMACollection add function\n"
          << "# All times are measured in milliseconds" << endl;
     int i = 0;
     for (size_t size = START; size <= STOP; size += STEP) {
@@ -171,6 +302,8 @@ int main(int argc, char* argv[])
       double avg5 = find_value(array, size, BINSEARCHTREE);
       double avg6 = find_value(array, size, AVLSEARCHTREE);
       double avg7 = find_value(array, size, RBTSEARCHTREE);
+      double avg8 = find_value(array, size, BTREE);
+      double avg9 = find_value(array, size, PMA);
       cout << size << " "
            << (avg1/1000.0) << " "
            << (avg2/1000.0) << " "
@@ -178,7 +311,9 @@ int main(int argc, char* argv[])
            << (avg4/1000.0) << " "
            << (avg5/1000.0) << " "
            << (avg6/1000.0) << " "
-           << (avg7/1000.0) << endl;       
+           << (avg7/1000.0) << " "
+           << (avg8/1000.0) << " "
+           << (avg9/1000.0) << endl;       
     }
   }
   // test 4: find-range operation
@@ -191,6 +326,8 @@ int main(int argc, char* argv[])
          << "# Column 6 = Avg time for BSTCollection add function\n"
          << "# Column 7 = Avg time for AVLCollection add function\n"
          << "# Column 8 = Avg time for RBTCollection add function\n"
+         << "# Column 9 = Avg time for BTreeCollection add function\n"
+         << "# Column 10 = Avg time for PMACollection add function\n"
          << "# All times are measured in milliseconds" << endl;
     int i = 0;
     for (size_t size = START; size <= STOP; size += STEP) {
@@ -201,6 +338,8 @@ int main(int argc, char* argv[])
       double avg5 = find_range(array, size, BINSEARCHTREE);
       double avg6 = find_range(array, size, AVLSEARCHTREE);
       double avg7 = find_range(array, size, RBTSEARCHTREE);
+      double avg8 = find_range(array, size, BTREE);
+      double avg9 = find_range(array, size, PMA);
       cout << size << " "
            << (avg1/1000.0) << " "
            << (avg2/1000.0) << " "
@@ -208,7 +347,9 @@ int main(int argc, char* argv[])
            << (avg4/1000.0) << " "
            << (avg5/1000.0) << " "
            << (avg6/1000.0) << " "
-           << (avg7/1000.0) << endl;
+           << (avg7/1000.0) << " "
+           << (avg8/1000.0) << " "
+           << (avg9/1000.0) << endl;
     }
   }
   // test 5: sort operation
@@ -221,6 +362,8 @@ int main(int argc, char* argv[])
          << "# Column 6 = Avg time for BSTCollection add function\n"
          << "# Column 7 = Avg time for AVLCollection add function\n"
          << "# Column 8 = Avg time for RBTCollection add function\n"
+         << "# Column 9 = Avg time for BTreeCollection add function\n"
+         << "# Column 10 = Avg time for PMACollection add function\n"
          << "# All times are measured in milliseconds" << endl;
     int i = 0;
     for (size_t size = START; size <= STOP; size += STEP) {
@@ -231,6 +374,8 @@ int main(int argc, char* argv[])
       double avg5 = sort(array, size, BINSEARCHTREE);
       double avg6 = sort(array, size, AVLSEARCHTREE);
       double avg7 = sort(array, size, RBTSEARCHTREE);
+      double avg8 = sort(array, size, BTREE);
+      double avg9 = sort(array, size, PMA);
       cout << size << " "
            << (avg1/1000.0) << " "
            << (avg2/1000.0) << " "
@@ -238,20 +383,559 @@ int main(int argc, char* argv[])
            << (avg4/1000.0) << " "
            << (avg5/1000.0) << " "
            << (avg6/1000.0) << " "
-           << (avg7/1000.0) << endl;
+           << (avg7/1000.0) << " "
+           << (avg8/1000.0) << " "
+           << (avg9/1000.0) << endl;
     }
   }
   // test 6: statistics information
   else if (test_number.compare("6") == 0) {
     cout << "# Column 1 = Input data size\n" 
          << "# Column 2 = Height for AVLCollection\n"
-         << "# Column 3 = Height for RBTCollection" << endl;
+         << "# Column 3 = Height for RBTCollection\n"
+         << "# Column 4 = Height for BTreeCollection" << endl;
     for (size_t size = START; size <= STOP; size += STEP) {
       size_t height1 = stats(array, size, AVLSEARCHTREE);
       size_t height2 = stats(array, size, RBTSEARCHTREE);
+      size_t height3 = stats(array, size, BTREE);
       cout << size << " "
            << height1 << " " 
-           << height2 << endl;
+           << height2 << " "
+           << height3 << endl;
+    }
+  }
+  // test 7: multithreaded mixed read/write throughput
+  else if (test_number.compare("7") == 0) {
+    const size_t SIZE = 100000;
+    size_t max_threads = thread::hardware_concurrency();
+    if (max_threads == 0)
+      max_threads = 1;
+    cout << "# Column 1 = Number of threads\n"
+         << "# Column 2 = Ops/ms for HashTableCollection behind one mutex\n"
+         << "# Column 3 = Ops/ms for ConcurrentHashTableCollection\n"
+         << "# Workload is 90% find, 5% add, 5% remove over "
+         << SIZE << " keys" << endl;
+    for (size_t threads = 1; threads <= max_threads; ++threads) {
+      double ops1 = throughput(array, SIZE, threads, HASHTABLE);
+      double ops2 = throughput(array, SIZE, threads, CONCURRENTHASHTABLE);
+      cout << threads << " "
+           << ops1 << " "
+           << ops2 << endl;
+    }
+  }
+  // test 8: per-find latency distribution for the hash tables
+  else if (test_number.compare("8") == 0) {
+    cout << "# Column 1 = Input data size\n"
+         << "# Column 2 = Avg find time for HashTableCollection\n"
+         << "# Column 3 = 99.9th percentile find time for HashTableCollection\n"
+         << "# Column 4 = Max find time for HashTableCollection\n"
+         << "# Column 5 = Avg find time for CuckooHashCollection\n"
+         << "# Column 6 = 99.9th percentile find time for CuckooHashCollection\n"
+         << "# Column 7 = Max find time for CuckooHashCollection\n"
+         << "# All times are measured in nanoseconds" << endl;
+    for (size_t size = START + STEP; size <= STOP; size += STEP) {
+      double avg1, avg2;
+      unsigned long p1, p2, max1, max2;
+      find_latency(array, size, HASHTABLE, avg1, p1, max1);
+      find_latency(array, size, CUCKOOHASHTABLE, avg2, p2, max2);
+      cout << size << " "
+           << avg1 << " " << p1 << " " << max1 << " "
+           << avg2 << " " << p2 << " " << max2 << endl;
+    }
+  }
+  // test 9: mixed workload of point lookups and small range queries
+  else if (test_number.compare("9") == 0) {
+    cout << "# Column 1 = Input data size\n"
+         << "# Column 2 = Total time for HashTableCollection\n"
+         << "# Column 3 = Total time for RBTCollection\n"
+         << "# Column 4 = Total time for HybridCollection\n"
+         << "# Workload is 1000 operations, 90% find value and 10% find range\n"
+         << "# All times are measured in milliseconds" << endl;
+    for (size_t size = START + 2 * STEP; size <= STOP; size += 2 * STEP) {
+      double time1 = mixed_queries(array, size, HASHTABLE);
+      double time2 = mixed_queries(array, size, RBTSEARCHTREE);
+      double time3 = mixed_queries(array, size, HYBRID);
+      cout << size << " "
+           << (time1/1000.0) << " "
+           << (time2/1000.0) << " "
+           << (time3/1000.0) << endl;
+    }
+  }
+  // test 10: hash table statistics
+  else if (test_number.compare("10") == 0) {
+    cout << "# Column 1 = Input data size\n"
+         << "# Column 2 = Number of buckets\n"
+         << "# Column 3 = Empty buckets\n"
+         << "# Column 4 = Min (non-empty) chain length\n"
+         << "# Column 5 = Max chain length\n"
+         << "# Column 6 = Avg (non-empty) chain length\n"
+         << "# Column 7 = Avg probes for a successful find\n"
+         << "# Column 8 = Avg probes for a failed find\n"
+         << "# Column 9 = Number of resizes\n"
+         << "# Column 10 = Bytes used" << endl;
+    for (size_t size = START; size <= STOP; size += STEP) {
+      HashTableStats stats;
+      hash_stats(array, size, stats);
+      cout << size << " "
+           << stats.bucket_count << " "
+           << stats.empty_buckets << " "
+           << stats.min_chain_length << " "
+           << stats.max_chain_length << " "
+           << stats.avg_chain_length << " "
+           << stats.avg_successful_probes << " "
+           << stats.avg_failed_probes << " "
+           << stats.resize_count << " "
+           << stats.bytes_used << endl;
+    }
+    // second data block: distributions for the largest table
+    HashTableStats stats;
+    hash_stats(array, STOP, stats);
+    cout << "\n\n# Distributions for input data size " << STOP << "\n"
+         << "# Column 1 = Chain length / number of probes\n"
+         << "# Column 2 = Buckets with this chain length (and so failed"
+         << " finds needing this many probes)\n"
+         << "# Column 3 = Successful finds needing this many probes"
+         << endl;
+    size_t rows = stats.chain_histogram.size();
+    if (stats.successful_probes.size() > rows)
+      rows = stats.successful_probes.size();
+    for (size_t i = 0; i < rows; ++i) {
+      // the lists can have different lengths, so missing counts are 0
+      cout << i << " "
+           << (i < stats.chain_histogram.size() ? stats.chain_histogram[i] : 0) << " "
+           << (i < stats.successful_probes.size() ? stats.successful_probes[i] : 0) << endl;
+    }
+  }
+  // test 11: keys on a table that was filled and then 90% drained
+  else if (test_number.compare("11") == 0) {
+    cout << "# Column 1 = Input data size (before draining)\n"
+         << "# Column 2 = Avg time for HashTableCollection keys function\n"
+         << "# Column 3 = Avg time for LinkedHashCollection keys function\n"
+         << "# All times are measured in milliseconds" << endl;
+    for (size_t size = START; size <= STOP; size += STEP) {
+      double avg1 = drained_keys(array, size, HASHTABLE);
+      double avg2 = drained_keys(array, size, LINKEDHASHTABLE);
+      cout << size << " "
+           << (avg1/1000.0) << " "
+           << (avg2/1000.0) << endl;
+    }
+  }
+  // test 12: building and searching a frozen (perfect hash) table
+  else if (test_number.compare("12") == 0) {
+    cout << "# Column 1 = Input data size\n"
+         << "# Column 2 = Time to add every key to HashTableCollection\n"
+         << "# Column 3 = Time to freeze that table into PerfectHashCollection\n"
+         << "# Column 4 = Avg find value time for HashTableCollection\n"
+         << "# Column 5 = Avg find value time for PerfectHashCollection\n"
+         << "# Build times are in milliseconds, find times in nanoseconds" << endl;
+    for (size_t size = START + STEP; size <= STOP; size += STEP) {
+      double build1, build2, find1, find2;
+      frozen(array, size, build1, build2, find1, find2);
+      cout << size << " "
+           << build1 << " "
+           << build2 << " "
+           << find1 << " "
+           << find2 << endl;
+    }
+  }
+  // test 13: bounded caches under a Zipfian key distribution
+  else if (test_number.compare("13") == 0) {
+    const size_t KEYS = 100000;
+    cout << "# Column 1 = Cache capacity (out of " << KEYS << " keys)\n"
+         << "# Column 2 = Hit ratio for LRU CacheCollection\n"
+         << "# Column 3 = Ops/ms for LRU CacheCollection\n"
+         << "# Column 4 = Hit ratio for CLOCK CacheCollection\n"
+         << "# Column 5 = Ops/ms for CLOCK CacheCollection\n"
+         << "# Each op is a find, followed by an add on a miss" << endl;
+    for (size_t capacity = KEYS / 100; capacity <= KEYS / 5; capacity += KEYS / 100) {
+      double ratio1, ratio2, ops1, ops2;
+      zipf_cache(array, KEYS, capacity, false, ratio1, ops1);
+      zipf_cache(array, KEYS, capacity, true, ratio2, ops2);
+      cout << capacity << " "
+           << ratio1 << " "
+           << ops1 << " "
+           << ratio2 << " "
+           << ops2 << endl;
+    }
+  }
+  // test 14: sorted array vs Eytzinger layout, up to 100M int keys
+  else if (test_number.compare("14") == 0) {
+    cout << "# Column 1 = Input data size\n"
+         << "# Column 2 = Avg find value time for BinSearchCollection\n"
+         << "# Column 3 = Avg find value time for EytzingerCollection\n"
+         << "# All times are measured in nanoseconds" << endl;
+    for (size_t size = 1000; size <= 100000000; size *= 10) {
+      double find1, find2;
+      eytzinger_find(size, find1, find2);
+      cout << size << " "
+           << find1 << " "
+           << find2 << endl;
+    }
+  }
+  // test 15: binary search with narrow and wide values, since keys and
+  // values are stored apart the wide values should cost nothing
+  else if (test_number.compare("15") == 0) {
+    cout << "# Column 1 = Input data size\n"
+         << "# Column 2 = Avg find value time for BinSearchCollection<int,int>\n"
+         << "# Column 3 = Avg find value time for BinSearchCollection<int,WideValue>\n"
+         << "# Column 4 = Avg find range time for BinSearchCollection<int,int>\n"
+         << "# Column 5 = Avg find range time for BinSearchCollection<int,WideValue>\n"
+         << "# Find value times are in nanoseconds, find range in microseconds"
+         << endl;
+    for (size_t size = 1000; size <= 4096000; size *= 4) {
+      double find1, find2, range1, range2;
+      value_width<int>(size, find1, range1);
+      value_width<WideValue>(size, find2, range2);
+      cout << size << " "
+           << find1 << " "
+           << find2 << " "
+           << range1 << " "
+           << range2 << endl;
+    }
+  }
+  // test 16: loading a collection in batches of different sizes
+  else if (test_number.compare("16") == 0) {
+    const size_t KEYS = 100000;
+    cout << "# Column 1 = Batch size (1 = one add per key)\n"
+         << "# Column 2 = Time to load " << KEYS << " keys into BinSearchCollection\n"
+         << "# Column 3 = Time to load " << KEYS << " keys into BSTCollection\n"
+         << "# Column 4 = Time to load " << KEYS << " keys into AVLCollection\n"
+         << "# Column 5 = Time to load " << KEYS << " keys into RBTCollection\n"
+         << "# All times are measured in milliseconds" << endl;
+    for (size_t batch_size = 1; batch_size <= KEYS; batch_size *= 10) {
+      double time1 = batch_load(array, KEYS, batch_size, BINSEARCH);
+      double time2 = batch_load(array, KEYS, batch_size, BINSEARCHTREE);
+      double time3 = batch_load(array, KEYS, batch_size, AVLSEARCHTREE);
+      double time4 = batch_load(array, KEYS, batch_size, RBTSEARCHTREE);
+      cout << batch_size << " "
+           << time1 << " "
+           << time2 << " "
+           << time3 << " "
+           << time4 << endl;
+    }
+  }
+  // test 17: find value under each binary search policy
+  else if (test_number.compare("17") == 0) {
+    cout << "# Column 1 = Input data size (random ascending int keys)\n"
+         << "# Column 2 = Avg find value time for BranchySearch\n"
+         << "# Column 3 = Avg find value time for BranchlessSearch\n"
+         << "# Column 4 = Avg find value time for KarySearch\n"
+         << "# Column 5 = Avg find value time for InterpolationSearch\n"
+         << "# All times are measured in nanoseconds" << endl;
+    for (size_t size = 1000; size <= 10000000; size *= 10) {
+      double avg1 = policy_find<BranchySearch>(size);
+      double avg2 = policy_find<BranchlessSearch>(size);
+      double avg3 = policy_find<KarySearch>(size);
+      double avg4 = policy_find<InterpolationSearch>(size);
+      cout << size << " "
+           << avg1 << " "
+           << avg2 << " "
+           << avg3 << " "
+           << avg4 << endl;
+    }
+    // second data block: the 4-letter string keys
+    const size_t KEYS = 100000;
+    cout << "\n\n# Column 1 = Input data size (4-letter string keys)\n"
+         << "# Columns 2-5 = As above" << endl;
+    cout << KEYS << " "
+         << policy_find<BranchySearch>(array, KEYS) << " "
+         << policy_find<BranchlessSearch>(array, KEYS) << " "
+         << policy_find<KarySearch>(array, KEYS) << " "
+         << policy_find<InterpolationSearch>(array, KEYS) << endl;
+  }
+  // test 18: range queries by copying keys, viewing them, or counting
+  else if (test_number.compare("18") == 0) {
+    cout << "# Column 1 = Input data size (int keys, ranges of 1000 keys)\n"
+         << "# Column 2 = Avg find range time (copied into an ArrayList)\n"
+         << "# Column 3 = Avg range time (ArraySlice view)\n"
+         << "# Column 4 = Avg count time\n"
+         << "# All times are measured in nanoseconds" << endl;
+    for (size_t size = 10000; size <= 10000000; size *= 10) {
+      double copy, slice, count;
+      slice_range(size, copy, slice, count);
+      cout << size << " "
+           << copy << " "
+           << slice << " "
+           << count << endl;
+    }
+  }
+  // test 19: heap bytes per entry, with and without values
+  else if (test_number.compare("19") == 0) {
+    const size_t KEYS = 10000000;
+    const int types[] = {BINSEARCH, HASHTABLE, BINSEARCHTREE, AVLSEARCHTREE,
+                         RBTSEARCHTREE};
+    const char* names[] = {"BinSearchCollection", "HashTableCollection",
+                           "BSTCollection", "AVLCollection", "RBTCollection"};
+    cout << "# Column 1 = Collection (" << KEYS << " int keys)\n"
+         << "# Column 2 = Heap bytes per entry with int values\n"
+         << "# Column 3 = Heap bytes per entry with NoValue values\n"
+         << "# Column 4 = Bytes saved per entry" << endl;
+    for (size_t i = 0; i < 5; ++i) {
+      double bytes1 = bytes_per_entry<int>(KEYS, types[i]);
+      double bytes2 = bytes_per_entry<NoValue>(KEYS, types[i]);
+      cout << names[i] << " "
+           << bytes1 << " "
+           << bytes2 << " "
+           << (bytes1 - bytes2) << endl;
+    }
+  }
+  // test 20: list sorts on already ordered and adversarial inputs
+  else if (test_number.compare("20") == 0) {
+    cout << "# Column 1 = Input data size (int items)\n"
+         << "# Column 2 = Avg quick sort time, sorted input\n"
+         << "# Column 3 = Avg intro sort time, sorted input\n"
+         << "# Column 4 = Avg quick sort time, reversed input\n"
+         << "# Column 5 = Avg intro sort time, reversed input\n"
+         << "# Column 6 = Avg quick sort time, 10 distinct items\n"
+         << "# Column 7 = Avg intro sort time, 10 distinct items\n"
+         << "# Column 8 = Avg quick sort time, random input\n"
+         << "# Column 9 = Avg intro sort time, random input\n"
+         << "# All times are measured in milliseconds" << endl;
+    // quick sort is quadratic (and recurses once per item) on the
+    // ordered inputs, so sizes stay small
+    const int orders[] = {SORTED_INPUT, REVERSED_INPUT, DUPLICATE_INPUT,
+                          RANDOM_INPUT};
+    for (size_t size = 2000; size <= 20000; size += 2000) {
+      cout << size;
+      for (size_t i = 0; i < 4; ++i)
+        cout << " " << list_sort<int>(size, orders[i], QUICKSORT)
+             << " " << list_sort<int>(size, orders[i], INTROSORT);
+      cout << endl;
+    }
+  }
+  // test 21: merge sort (stable) vs intro sort up to 10M items
+  else if (test_number.compare("21") == 0) {
+    cout << "# Column 1 = Input data size (random items)\n"
+         << "# Column 2 = Avg merge sort time, int items\n"
+         << "# Column 3 = Avg intro sort time, int items\n"
+         << "# Column 4 = Avg merge sort time, 10-character string items\n"
+         << "# Column 5 = Avg intro sort time, 10-character string items\n"
+         << "# All times are measured in milliseconds" << endl;
+    for (size_t size = 10000; size <= 10000000; size *= 10) {
+      double avg1 = list_sort<int>(size, RANDOM_INPUT, MERGESORT);
+      double avg2 = list_sort<int>(size, RANDOM_INPUT, INTROSORT);
+      double avg3 = list_sort<string>(size, RANDOM_INPUT, MERGESORT);
+      double avg4 = list_sort<string>(size, RANDOM_INPUT, INTROSORT);
+      cout << size << " "
+           << avg1 << " "
+           << avg2 << " "
+           << avg3 << " "
+           << avg4 << endl;
+    }
+  }
+  // test 22: sort scaling with thread count
+  else if (test_number.compare("22") == 0) {
+    const size_t LIST_SIZE = 10000000;
+    const size_t TABLE_SIZE = 1000000;
+    size_t max_threads = thread::hardware_concurrency();
+    if (max_threads == 0)
+      max_threads = 1;
+    cout << "# Column 1 = Number of threads\n"
+         << "# Column 2 = Avg ArrayList sort time (" << LIST_SIZE
+         << " random ints)\n"
+         << "# Column 3 = Avg HashTableCollection sort time (" << TABLE_SIZE
+         << " random int keys)\n"
+         << "# All times are measured in milliseconds" << endl;
+    for (size_t threads = 1; threads <= max_threads; ++threads) {
+      double avg1 = threaded_sort(LIST_SIZE, threads, ARRAYLIST);
+      double avg2 = threaded_sort(TABLE_SIZE, threads, HASHTABLE);
+      cout << threads << " "
+           << avg1 << " "
+           << avg2 << endl;
+    }
+  }
+  // test 23: radix sort against the comparison sorts
+  else if (test_number.compare("23") == 0) {
+    cout << "# Column 1 = Input data size (random 64-bit int keys)\n"
+         << "# Column 2 = Avg quick sort time\n"
+         << "# Column 3 = Avg merge sort time\n"
+         << "# Column 4 = Avg intro sort time\n"
+         << "# Column 5 = Avg radix sort time\n"
+         << "# All times are measured in milliseconds" << endl;
+    for (size_t size = 10000; size <= 10000000; size *= 10) {
+      double avg1 = list_sort<long>(size, RANDOM_INPUT, QUICKSORT);
+      double avg2 = list_sort<long>(size, RANDOM_INPUT, MERGESORT);
+      double avg3 = list_sort<long>(size, RANDOM_INPUT, INTROSORT);
+      double avg4 = list_sort<long>(size, RANDOM_INPUT, RADIXSORT);
+      cout << size << " "
+           << avg1 << " "
+           << avg2 << " "
+           << avg3 << " "
+           << avg4 << endl;
+    }
+    // second data block: the 4-letter keys from create_pairs
+    cout << "\n\n# Column 1 = Input data size (4-letter string keys)\n"
+         << "# Columns 2-5 = As above" << endl;
+    for (size_t size = 50000; size <= STOP; size += 50000) {
+      double avg1 = key_sort(array, size, QUICKSORT);
+      double avg2 = key_sort(array, size, MERGESORT);
+      double avg3 = key_sort(array, size, INTROSORT);
+      double avg4 = key_sort(array, size, RADIXSORT);
+      cout << size << " "
+           << avg1 << " "
+           << avg2 << " "
+           << avg3 << " "
+           << avg4 << endl;
+    }
+  }
+  // test 24: adds and removes that shift or grow an ArrayList
+  else if (test_number.compare("24") == 0) {
+    cout << "# Column 1 = Input data size\n"
+         << "# Column 2 = Avg add time for ArrayListCollection (string keys)\n"
+         << "# Column 3 = Avg remove time for ArrayListCollection (string keys)\n"
+         << "# Column 4 = Avg add time for BinSearchCollection (string keys)\n"
+         << "# Column 5 = Avg remove time for BinSearchCollection (string keys)\n"
+         << "# Column 6 = Avg add time for BinSearchCollection (int keys)\n"
+         << "# Column 7 = Avg remove time for BinSearchCollection (int keys)\n"
+         << "# Times are per operation while filling from empty and then\n"
+         << "# emptying again, measured in nanoseconds" << endl;
+    for (size_t size = 10000; size <= 50000; size += 10000) {
+      double add1, remove1, add2, remove2, add3, remove3;
+      add_remove<string>(array, size, ARRAYLIST, add1, remove1);
+      add_remove<string>(array, size, BINSEARCH, add2, remove2);
+      add_remove<int>(array, size, BINSEARCH, add3, remove3);
+      cout << size << " "
+           << add1 << " "
+           << remove1 << " "
+           << add2 << " "
+           << remove2 << " "
+           << add3 << " "
+           << remove3 << endl;
+    }
+  }
+  // test 25: reading every item of an ArrayList with and without copies
+  else if (test_number.compare("25") == 0) {
+    cout << "# Column 1 = Input data size (string items)\n"
+         << "# Column 2 = Avg time per item, get (copies each item)\n"
+         << "# Column 3 = Avg time per item, operator[]\n"
+         << "# Column 4 = Avg time per item, range-based for\n"
+         << "# Column 5 = Avg time per item, ArraySlice view\n"
+         << "# Column 6 = Avg ArrayListCollection find value time (us)\n"
+         << "# Column 7 = Avg ArrayListCollection find range time (us)\n"
+         << "# Columns 2-5 are measured in nanoseconds" << endl;
+    for (size_t size = 50000; size <= STOP; size += 50000) {
+      double avg1 = list_scan(array, size, GET_SCAN);
+      double avg2 = list_scan(array, size, INDEX_SCAN);
+      double avg3 = list_scan(array, size, RANGE_FOR_SCAN);
+      double avg4 = list_scan(array, size, VIEW_SCAN);
+      double avg5 = find_value(array, size, ARRAYLIST);
+      double avg6 = find_range(array, size, ARRAYLIST);
+      cout << size << " "
+           << avg1 << " "
+           << avg2 << " "
+           << avg3 << " "
+           << avg4 << " "
+           << avg5 << " "
+           << avg6 << endl;
+    }
+  }
+  // test 26: allocation cost of small range find results
+  else if (test_number.compare("26") == 0) {
+    const size_t KEYS = 300000;
+    cout << "# Column 1 = Keys per range find (BinSearchCollection, "
+         << KEYS << " keys)\n"
+         << "# Column 2 = Avg find range time into an ArrayList (int keys)\n"
+         << "# Column 3 = Avg find range time into a SmallArrayList<16> (int keys)\n"
+         << "# Column 4 = Avg find range time into an ArrayList (string keys)\n"
+         << "# Column 5 = Avg find range time into a SmallArrayList<16> (string keys)\n"
+         << "# All times are measured in nanoseconds" << endl;
+    BinSearchCollection<int,int> ints;
+    BinSearchCollection<string,int> strings;
+    ArrayList<pair<int,int>> int_batch;
+    ArrayList<pair<string,int>> string_batch;
+    for (size_t i = 0; i < KEYS; ++i) {
+      int_batch.add(pair<int,int>(2 * i, i));
+      string_batch.add(array[i]);
+    }
+    ints.add_batch(int_batch);
+    strings.add_batch(string_batch);
+    ArrayList<int> int_keys;
+    ArrayList<string> string_keys;
+    ints.sort(int_keys);
+    strings.sort(string_keys);
+    for (size_t width = 1; width <= 64; width *= 2) {
+      double avg1 = small_range<int, ArrayList<int>>(ints, int_keys, width);
+      double avg2 = small_range<int, SmallArrayList<int>>(ints, int_keys, width);
+      double avg3 = small_range<string, ArrayList<string>>(strings, string_keys, width);
+      double avg4 = small_range<string, SmallArrayList<string>>(strings, string_keys, width);
+      cout << width << " "
+           << avg1 << " "
+           << avg2 << " "
+           << avg3 << " "
+           << avg4 << endl;
+    }
+  }
+  // test 27: per-append latency, where resizes show up as the tail
+  else if (test_number.compare("27") == 0) {
+    const size_t ITEMS = 10000000;
+    cout << "# Column 1 = List (" << ITEMS << " appends)\n"
+         << "# Column 2 = Avg append time\n"
+         << "# Column 3 = Median append time\n"
+         << "# Column 4 = 99th percentile append time\n"
+         << "# Column 5 = 99.99th percentile append time\n"
+         << "# Column 6 = Max append time\n"
+         << "# All times are measured in nanoseconds" << endl;
+    const char* names[] = {"ArrayList<int>", "SegmentedList<int>",
+                           "ArrayList<string>", "SegmentedList<string>"};
+    for (size_t i = 0; i < 4; ++i) {
+      double avg;
+      unsigned long p50, p99, p9999, max;
+      if (i == 0)
+        append_latency<ArrayList<int>>(ITEMS, avg, p50, p99, p9999, max);
+      else if (i == 1)
+        append_latency<SegmentedList<int>>(ITEMS, avg, p50, p99, p9999, max);
+      else if (i == 2)
+        append_latency<ArrayList<string>>(ITEMS, avg, p50, p99, p9999, max);
+      else
+        append_latency<SegmentedList<string>>(ITEMS, avg, p50, p99, p9999, max);
+      cout << names[i] << " "
+           << avg << " "
+           << p50 << " "
+           << p99 << " "
+           << p9999 << " "
+           << max << endl;
+    }
+  }
+  // test 28: the linked list collection's scans
+  else if (test_number.compare("28") == 0) {
+    cout << "# Column 1 = Input data size\n"
+         << "# Column 2 = Avg find value time for LinkedListCollection\n"
+         << "# Column 3 = Avg find range time for LinkedListCollection\n"
+         << "# Column 4 = Avg sort time for LinkedListCollection\n"
+         << "# Column 5 = Avg remove time for LinkedListCollection\n"
+         << "# All times are measured in microseconds" << endl;
+    for (size_t size = 5000; size <= 25000; size += 5000) {
+      double find1, find2, sort_time, remove_time;
+      linked_list_scans(array, size, find1, find2, sort_time, remove_time);
+      cout << size << " "
+           << find1 << " "
+           << find2 << " "
+           << sort_time << " "
+           << remove_time << endl;
+    }
+  }
+  // test 29: walking and inserting into the list types
+  else if (test_number.compare("29") == 0) {
+    cout << "# Column 1 = Input data size (int items)\n"
+         << "# Column 2 = Avg traversal time per item for LinkedList\n"
+         << "# Column 3 = Avg traversal time per item for UnrolledLinkedList\n"
+         << "# Column 4 = Avg traversal time per item for ArrayList\n"
+         << "# Column 5 = Avg insert (random index) time for LinkedList\n"
+         << "# Column 6 = Avg insert (random index) time for UnrolledLinkedList\n"
+         << "# Column 7 = Avg insert (random index) time for ArrayList\n"
+         << "# All times are measured in nanoseconds" << endl;
+    for (size_t size = 1000; size <= 1000000; size *= 10) {
+      double traverse1, traverse2, traverse3, insert1, insert2, insert3;
+      traverse_insert<LinkedList<int>>(size, traverse1, insert1);
+      traverse_insert<UnrolledLinkedList<int>>(size, traverse2, insert2);
+      traverse_insert<ArrayList<int>>(size, traverse3, insert3);
+      cout << size << " "
+           << traverse1 << " "
+           << traverse2 << " "
+           << traverse3 << " "
+           << insert1 << " "
+           << insert2 << " "
+           << insert3 << endl;
     }
   }
   else {
@@ -348,9 +1032,7 @@ void print(const Collection<string,int>& coll)
   ArrayList<string> keys;
   coll.keys(keys);
   for (size_t i = 0; i < keys.size(); ++i) {
-    string key = "";
-    keys.get(i, key);
-    cout << key;
+    cout << keys[i];
     if (i < keys.size() - 1)
       cout << ", ";
   }
@@ -376,6 +1058,10 @@ double add(pair<string,int> array[], size_t size, int type)
     collection = new AVLCollection<string,int>;
   else if (type == RBTSEARCHTREE)
     collection = new RBTCollection<string,int>;
+  else if (type == BTREE)
+    collection = new BTreeCollection<string,int>;
+  else if (type == PMA)
+    collection = new PMACollection<string,int>;
   for (size_t i = 0; i < size; ++i)
     collection->add(array[i].first, array[i].second);
   if (type == RBTSEARCHTREE)
@@ -410,6 +1096,10 @@ double remove(pair<string,int> array[], size_t size, int type)
     collection = new AVLCollection<string,int>;    
   else if (type == RBTSEARCHTREE)
     collection = new RBTCollection<string,int>;
+  else if (type == BTREE)
+    collection = new BTreeCollection<string,int>;
+  else if (type == PMA)
+    collection = new PMACollection<string,int>;
   for (size_t i = 0; i < size; ++i)
     collection->add(array[i].first, array[i].second);
   if (type == RBTSEARCHTREE)
@@ -447,6 +1137,10 @@ double find_value(pair<string,int> array[], size_t size, int type)
     collection = new AVLCollection<string,int>;    
   else if (type == RBTSEARCHTREE)
     collection = new RBTCollection<string,int>;
+  else if (type == BTREE)
+    collection = new BTreeCollection<string,int>;
+  else if (type == PMA)
+    collection = new PMACollection<string,int>;
   for (size_t i = 0; i < size; ++i)
     collection->add(array[i].first, array[i].second);
   if (type == RBTSEARCHTREE)
@@ -481,6 +1175,10 @@ double find_range(pair<string,int> array[], size_t size, int type)
     collection = new AVLCollection<string,int>;    
   else if (type == RBTSEARCHTREE)
     collection = new RBTCollection<string,int>;
+  else if (type == BTREE)
+    collection = new BTreeCollection<string,int>;
+  else if (type == PMA)
+    collection = new PMACollection<string,int>;
   for (size_t i = 0; i < size; ++i)
     collection->add(array[i].first, array[i].second);
   if (type == RBTSEARCHTREE)
@@ -519,6 +1217,10 @@ double sort(pair<string,int> array[], size_t size, int type)
     collection = new AVLCollection<string,int>;    
   else if (type == RBTSEARCHTREE)
     collection = new RBTCollection<string,int>;
+  else if (type == BTREE)
+    collection = new BTreeCollection<string,int>;
+  else if (type == PMA)
+    collection = new PMACollection<string,int>;
   for (size_t i = 0; i < size; ++i)
     collection->add(array[i].first, array[i].second);
   if (type == RBTSEARCHTREE)
@@ -530,12 +1232,8 @@ double sort(pair<string,int> array[], size_t size, int type)
     collection->sort(keys);
     auto end = high_resolution_clock::now();
     if (keys.size() > 0) 
-      for (size_t i = 0; i < keys.size() - 1; ++i) {
-        string val1 = "", val2 = "";
-        keys.get(i, val1);
-        keys.get(i + 1, val2);
-        assert(val1 < val2);
-      }
+      for (size_t i = 0; i < keys.size() - 1; ++i)
+        assert(keys[i] < keys[i + 1]);
     times[i] = duration_cast<microseconds>(end - start).count();
   }
   delete collection;
@@ -568,8 +1266,783 @@ size_t stats(pair<string,int> array[], size_t size, int type)
     height = collection->height();
     delete collection;
   }
+  else if (type == BTREE) {
+    BTreeCollection<string,int>* collection = new BTreeCollection<string,int>;
+    for (size_t i = 0; i < size; ++i)
+      collection->add(array[i].first, array[i].second);
+    height = collection->height();
+    delete collection;
+  }
   return height;
 }
 
 
+double throughput(pair<string,int> array[], size_t size, size_t threads, int type)
+{
+  const size_t OPS = 200000;             // operations per thread
+  const size_t TOTAL = 300000;           // keys available in array
+  Collection<string,int>* collection;
+  if (type == HASHTABLE)
+    collection = new HashTableCollection<string,int>;
+  else
+    collection = new ConcurrentHashTableCollection<string,int>;
+  for (size_t i = 0; i < size; ++i)
+    collection->add(array[i].first, array[i].second);
+  // the plain hash table is shared behind one global lock
+  mutex global_lock;
+  bool locked = type == HASHTABLE;
+  // each thread adds and removes from its own slice of unused keys
+  size_t chunk = (TOTAL - size) / threads;
+  auto worker = [&](size_t t) {
+    size_t first = size + t * chunk;
+    size_t added = 0;
+    unsigned long r = 2166136261ul + t;
+    for (size_t i = 0; i < OPS; ++i) {
+      r = r * 6364136223846793005ul + 1442695040888963407ul;
+      size_t op = (r >> 33) % 100;
+      int val;
+      if (locked)
+        global_lock.lock();
+      if (op < 90)
+        collection->find(array[(r >> 17) % size].first, val);
+      else if ((op < 95 && added < chunk) || added == 0) {
+        collection->add(array[first + added].first, array[first + added].second);
+        ++added;
+      }
+      else {
+        --added;
+        collection->remove(array[first + added].first);
+      }
+      if (locked)
+        global_lock.unlock();
+    }
+  };
+  auto start = high_resolution_clock::now();
+  thread* pool = new thread[threads];
+  for (size_t t = 0; t < threads; ++t)
+    pool[t] = thread(worker, t);
+  for (size_t t = 0; t < threads; ++t)
+    pool[t].join();
+  auto end = high_resolution_clock::now();
+  delete [] pool;
+  delete collection;
+  double ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+  return (OPS * threads) / ms;
+}
+
+
+void find_latency(pair<string,int> array[], size_t size, int type,
+                  double& avg, unsigned long& p999, unsigned long& max)
+{
+  Collection<string,int>* collection;
+  if (type == HASHTABLE)
+    collection = new HashTableCollection<string,int>;
+  else
+    collection = new CuckooHashCollection<string,int>;
+  for (size_t i = 0; i < size; ++i)
+    collection->add(array[i].first, array[i].second);
+  assert(collection->size() == size);
+  // time every key individually so the tail is visible
+  unsigned long* times = new unsigned long[size];
+  for (size_t i = 0; i < size; ++i) {
+    int val;
+    auto start = high_resolution_clock::now();
+    collection->find(array[i].first, val);
+    auto end = high_resolution_clock::now();
+    times[i] = duration_cast<nanoseconds>(end - start).count();
+  }
+  std::sort(times, times + size);
+  avg = sum(times, size) / (size*1.0);
+  p999 = times[(size_t)((size - 1) * 0.999)];
+  max = times[size - 1];
+  delete [] times;
+  delete collection;
+}
+
+
+double mixed_queries(pair<string,int> array[], size_t size, int type)
+{
+  const size_t OPS = 1000;
+  const size_t RANGE = 100;              // keys per range query
+  Collection<string,int>* collection;
+  if (type == HASHTABLE)
+    collection = new HashTableCollection<string,int>;
+  else if (type == RBTSEARCHTREE)
+    collection = new RBTCollection<string,int>;
+  else
+    collection = new HybridCollection<string,int>;
+  for (size_t i = 0; i < size; ++i)
+    collection->add(array[i].first, array[i].second);
+  assert(collection->size() == size);
+  // the i-th smallest key spells out i in base 26
+  auto ith_key = [](size_t i) {
+    string str = "AAAA";
+    for (int pos = 3; pos >= 0; --pos, i /= 26)
+      str[pos] = 'A' + (i % 26);
+    return str;
+  };
+  unsigned long r = 2166136261ul;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < OPS; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    size_t k = (r >> 17) % size;
+    if ((r >> 33) % 10 == 0) {
+      ArrayList<string> keys;
+      size_t k2 = (k + RANGE < size) ? k + RANGE : size - 1;
+      collection->find(ith_key(k), ith_key(k2), keys);
+    }
+    else {
+      int val;
+      collection->find(array[k].first, val);
+    }
+  }
+  auto end = high_resolution_clock::now();
+  delete collection;
+  return duration_cast<microseconds>(end - start).count();
+}
+
+
+void hash_stats(pair<string,int> array[], size_t size, HashTableStats& stats)
+{
+  HashTableCollection<string,int>* collection = new HashTableCollection<string,int>;
+  for (size_t i = 0; i < size; ++i)
+    collection->add(array[i].first, array[i].second);
+  assert(collection->size() == size);
+  collection->statistics(stats);
+  delete collection;
+}
+
+
+double drained_keys(pair<string,int> array[], size_t size, int type)
+{
+  unsigned long times[ITERATIONS];
+  Collection<string,int>* collection;
+  if (type == HASHTABLE)
+    collection = new HashTableCollection<string,int>;
+  else
+    collection = new LinkedHashCollection<string,int>;
+  for (size_t i = 0; i < size; ++i)
+    collection->add(array[i].first, array[i].second);
+  // remove 9 out of every 10 keys, the table keeps its capacity
+  for (size_t i = 0; i < size; ++i)
+    if (i % 10 != 0)
+      collection->remove(array[i].first);
+  assert(collection->size() == (size + 9) / 10);
+  for (size_t i = 0; i < ITERATIONS; ++i) {
+    ArrayList<string> keys;
+    auto start = high_resolution_clock::now();
+    collection->keys(keys);
+    auto end = high_resolution_clock::now();
+    times[i] = duration_cast<microseconds>(end - start).count();
+  }
+  delete collection;
+  return sum(times, ITERATIONS) / (ITERATIONS*1.0);
+}
+
+
+void frozen(pair<string,int> array[], size_t size, double& build1, double& build2,
+            double& find1, double& find2)
+{
+  auto start = high_resolution_clock::now();
+  HashTableCollection<string,int>* collection = new HashTableCollection<string,int>;
+  for (size_t i = 0; i < size; ++i)
+    collection->add(array[i].first, array[i].second);
+  auto end = high_resolution_clock::now();
+  build1 = duration_cast<microseconds>(end - start).count() / 1000.0;
+  start = high_resolution_clock::now();
+  PerfectHashCollection<string,int>* frozen_collection =
+    new PerfectHashCollection<string,int>(*collection);
+  end = high_resolution_clock::now();
+  build2 = duration_cast<microseconds>(end - start).count() / 1000.0;
+  assert(frozen_collection->size() == size);
+  // look up every key in each table
+  int val;
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < size; ++i)
+    collection->find(array[i].first, val);
+  end = high_resolution_clock::now();
+  find1 = duration_cast<nanoseconds>(end - start).count() / (size*1.0);
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < size; ++i)
+    frozen_collection->find(array[i].first, val);
+  end = high_resolution_clock::now();
+  find2 = duration_cast<nanoseconds>(end - start).count() / (size*1.0);
+  delete frozen_collection;
+  delete collection;
+}
+
+
+void zipf_cache(pair<string,int> array[], size_t keys, size_t capacity, bool clock,
+                double& ratio, double& ops)
+{
+  const size_t OPS = 500000;
+  const double SKEW = 0.99;
+  // cumulative zipf probabilities, key i has weight 1/(i+1)^SKEW
+  double* cdf = new double[keys];
+  double total = 0;
+  for (size_t i = 0; i < keys; ++i) {
+    total += 1.0 / pow(i + 1.0, SKEW);
+    cdf[i] = total;
+  }
+  // pick the key sequence up front so only the cache is timed
+  size_t* sequence = new size_t[OPS];
+  unsigned long r = 2166136261ul;
+  for (size_t i = 0; i < OPS; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    double u = ((r >> 11) * (1.0 / 9007199254740992.0)) * total;
+    sequence[i] = std::lower_bound(cdf, cdf + keys, u) - cdf;
+    if (sequence[i] >= keys)
+      sequence[i] = keys - 1;
+  }
+  CacheCollection<string,int> cache(capacity, clock ? CacheCollection<string,int>::CLOCK
+                                                    : CacheCollection<string,int>::LRU);
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < OPS; ++i) {
+    int val;
+    const pair<string,int>& p = array[sequence[i]];
+    if (!cache.find(p.first, val))
+      cache.add(p.first, p.second);
+  }
+  auto end = high_resolution_clock::now();
+  assert(cache.size() <= capacity);
+  ratio = cache.hit_ratio();
+  ops = OPS / (duration_cast<microseconds>(end - start).count() / 1000.0);
+  delete [] sequence;
+  delete [] cdf;
+}
+
+
+void eytzinger_find(size_t size, double& find1, double& find2)
+{
+  const size_t LOOKUPS = 1000000;
+  // ascending adds keep the binary search collection's adds O(1)
+  BinSearchCollection<int,int>* collection = new BinSearchCollection<int,int>;
+  for (size_t i = 0; i < size; ++i)
+    collection->add(2 * i, i);
+  EytzingerCollection<int,int>* frozen_collection =
+    new EytzingerCollection<int,int>(*collection);
+  assert(frozen_collection->size() == size);
+  // pick the keys up front, half of them missing (odd)
+  int* lookups = new int[LOOKUPS];
+  unsigned long r = 2166136261ul;
+  for (size_t i = 0; i < LOOKUPS; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    lookups[i] = (r >> 17) % (2 * size);
+  }
+  int val;
+  size_t found1 = 0, found2 = 0;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < LOOKUPS; ++i)
+    found1 += collection->find(lookups[i], val);
+  auto end = high_resolution_clock::now();
+  find1 = duration_cast<nanoseconds>(end - start).count() / (LOOKUPS*1.0);
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < LOOKUPS; ++i)
+    found2 += frozen_collection->find(lookups[i], val);
+  end = high_resolution_clock::now();
+  find2 = duration_cast<nanoseconds>(end - start).count() / (LOOKUPS*1.0);
+  assert(found1 == found2);
+  delete [] lookups;
+  delete frozen_collection;
+  delete collection;
+}
+
+
+template<typename V>
+void value_width(size_t size, double& find, double& range)
+{
+  const size_t LOOKUPS = 1000000;
+  const size_t RANGES = 1000;
+  const size_t RANGE_WIDTH = 100;
+  BinSearchCollection<int,V>* collection = new BinSearchCollection<int,V>;
+  V val = V();
+  for (size_t i = 0; i < size; ++i)
+    collection->add(i, val);
+  unsigned long r = 2166136261ul;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < LOOKUPS; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    collection->find((r >> 17) % size, val);
+  }
+  auto end = high_resolution_clock::now();
+  find = duration_cast<nanoseconds>(end - start).count() / (LOOKUPS*1.0);
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < RANGES; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    int k1 = (r >> 17) % size;
+    ArrayList<int> keys;
+    collection->find(k1, k1 + RANGE_WIDTH - 1, keys);
+  }
+  end = high_resolution_clock::now();
+  range = duration_cast<nanoseconds>(end - start).count() / (RANGES*1000.0);
+  delete collection;
+}
+
+
+double batch_load(pair<string,int> array[], size_t size, size_t batch_size, int type)
+{
+  Collection<string,int>* collection;
+  if (type == BINSEARCH)
+    collection = new BinSearchCollection<string,int>;
+  else if (type == BINSEARCHTREE)
+    collection = new BSTCollection<string,int>;
+  else if (type == AVLSEARCHTREE)
+    collection = new AVLCollection<string,int>;
+  else if (type == RBTSEARCHTREE)
+    collection = new RBTCollection<string,int>;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < size; i += batch_size) {
+    if (batch_size == 1) {
+      collection->add(array[i].first, array[i].second);
+      continue;
+    }
+    ArrayList<pair<string,int>> batch;
+    for (size_t j = i; j < i + batch_size && j < size; ++j)
+      batch.add(array[j]);
+    collection->add_batch(batch);
+  }
+  auto end = high_resolution_clock::now();
+  assert(collection->size() == size);
+  if (type == RBTSEARCHTREE)
+    assert(((RBTCollection<string,int>*)collection)->valid_rbt());
+  delete collection;
+  return duration_cast<microseconds>(end - start).count() / 1000.0;
+}
+
+
+template<typename Search>
+double policy_find(size_t size)
+{
+  const size_t LOOKUPS = 1000000;
+  // ascending adds with random gaps, remembering the keys to look up
+  BinSearchCollection<long,int,Search>* collection =
+    new BinSearchCollection<long,int,Search>;
+  long* keys = new long[size];
+  unsigned long r = 2166136261ul;
+  long key = 0;
+  for (size_t i = 0; i < size; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    key += 1 + (r >> 54);
+    keys[i] = key;
+    collection->add(key, i);
+  }
+  int val;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < LOOKUPS; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    collection->find(keys[(r >> 17) % size], val);
+  }
+  auto end = high_resolution_clock::now();
+  delete [] keys;
+  delete collection;
+  return duration_cast<nanoseconds>(end - start).count() / (LOOKUPS*1.0);
+}
+
 
+template<typename Search>
+double policy_find(pair<string,int> array[], size_t size)
+{
+  BinSearchCollection<string,int,Search> collection;
+  ArrayList<pair<string,int>> batch;
+  for (size_t i = 0; i < size; ++i)
+    batch.add(array[i]);
+  collection.add_batch(batch);
+  int val;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < size; ++i)
+    collection.find(array[i].first, val);
+  auto end = high_resolution_clock::now();
+  return duration_cast<nanoseconds>(end - start).count() / (size*1.0);
+}
+
+
+void slice_range(size_t size, double& copy, double& slice, double& count)
+{
+  const size_t RANGES = 10000;
+  const int WIDTH = 1000;
+  BinSearchCollection<int,int> collection;
+  for (size_t i = 0; i < size; ++i)
+    collection.add(i, i);
+  // pick the range starts up front
+  int* starts = new int[RANGES];
+  unsigned long r = 2166136261ul;
+  for (size_t i = 0; i < RANGES; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    starts[i] = (r >> 17) % (size - WIDTH);
+  }
+  size_t total1 = 0, total2 = 0, total3 = 0;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < RANGES; ++i) {
+    ArrayList<int> keys;
+    collection.find(starts[i], starts[i] + WIDTH - 1, keys);
+    total1 += keys.size();
+  }
+  auto end = high_resolution_clock::now();
+  copy = duration_cast<nanoseconds>(end - start).count() / (RANGES*1.0);
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < RANGES; ++i)
+    total2 += collection.range(starts[i], starts[i] + WIDTH - 1).size();
+  end = high_resolution_clock::now();
+  slice = duration_cast<nanoseconds>(end - start).count() / (RANGES*1.0);
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < RANGES; ++i)
+    total3 += collection.count(starts[i], starts[i] + WIDTH - 1);
+  end = high_resolution_clock::now();
+  count = duration_cast<nanoseconds>(end - start).count() / (RANGES*1.0);
+  assert(total1 == total2 && total2 == total3);
+  delete [] starts;
+}
+
+
+template<typename V>
+double bytes_per_entry(size_t size, int type)
+{
+  // measure what the collection holds on to, so the batch is built
+  // (and freed) outside the measurement
+  ArrayList<pair<int,V>>* batch = nullptr;
+  if (type == BINSEARCH) {
+    batch = new ArrayList<pair<int,V>>;
+    for (size_t i = 0; i < size; ++i)
+      batch->add(pair<int,V>((int) ((i * 2654435761ul) % size), V()));
+  }
+  // large arrays are mmapped, which uordblks doesn't count
+  struct mallinfo2 info = mallinfo2();
+  size_t before = info.uordblks + info.hblkhd;
+  Collection<int,V>* collection;
+  if (type == BINSEARCH)
+    collection = new BinSearchCollection<int,V>;
+  else if (type == HASHTABLE)
+    collection = new HashTableCollection<int,V>;
+  else if (type == BINSEARCHTREE)
+    collection = new BSTCollection<int,V>;
+  else if (type == AVLSEARCHTREE)
+    collection = new AVLCollection<int,V>;
+  else if (type == RBTSEARCHTREE)
+    collection = new RBTCollection<int,V>;
+  // adds in key order are quadratic for the binary search collection
+  // and make the plain BST a list, so merge a batch or scramble the
+  // keys (multiplying by a prime mod size permutes them)
+  if (type == BINSEARCH)
+    collection->add_batch(*batch);
+  else {
+    for (size_t i = 0; i < size; ++i)
+      collection->add((int) ((i * 2654435761ul) % size), V());
+  }
+  info = mallinfo2();
+  size_t after = info.uordblks + info.hblkhd;
+  assert(collection->size() == size);
+  delete collection;
+  delete batch;
+  return (after - before) / (size*1.0);
+}
+
+
+
+template<typename T>
+double list_sort(size_t size, int order, int algorithm)
+{
+  unsigned long times[ITERATIONS];
+  unsigned long r = 2166136261ul;
+  for (size_t i = 0; i < ITERATIONS; ++i) {
+    ArrayList<T> list;
+    for (size_t j = 0; j < size; ++j) {
+      r = r * 6364136223846793005ul + 1442695040888963407ul;
+      if (order == SORTED_INPUT)
+        list.add(sort_item<T>(j));
+      else if (order == REVERSED_INPUT)
+        list.add(sort_item<T>(size - j));
+      else if (order == DUPLICATE_INPUT)
+        list.add(sort_item<T>((r >> 33) % 10));
+      else if (is_integral<T>::value && sizeof(T) == 8)
+        list.add(sort_item<T>(r));
+      else
+        list.add(sort_item<T>(r >> 33));
+    }
+    auto start = high_resolution_clock::now();
+    if (algorithm == QUICKSORT)
+      list.quick_sort();
+    else if (algorithm == INTROSORT)
+      list.intro_sort();
+    else if (algorithm == MERGESORT)
+      list.merge_sort();
+    else
+      list.radix_sort();
+    auto end = high_resolution_clock::now();
+    for (size_t j = 1; j < size; ++j)
+      assert(!(list[j] < list[j - 1]));
+    times[i] = duration_cast<microseconds>(end - start).count();
+  }
+  return sum(times, ITERATIONS) / (ITERATIONS*1000.0);
+}
+
+
+// n as an item; strings are zero-padded to 10 digits so they sort in
+// the same order as the numbers
+template<typename T>
+T sort_item(unsigned long n)
+{
+  if constexpr (is_same<T,string>::value) {
+    string digits = to_string(n);
+    return string(10 - digits.size(), '0') + digits;
+  } else
+    return n;
+}
+
+
+double threaded_sort(size_t size, size_t threads, int type)
+{
+  unsigned long times[ITERATIONS];
+  unsigned long r = 2166136261ul;
+  HashTableCollection<int,int> collection;
+  if (type == HASHTABLE) {
+    for (size_t i = 0; i < size; ++i) {
+      r = r * 6364136223846793005ul + 1442695040888963407ul;
+      collection.add(r >> 33, i);
+    }
+  }
+  for (size_t i = 0; i < ITERATIONS; ++i) {
+    ArrayList<int> list;
+    if (type == ARRAYLIST) {
+      for (size_t j = 0; j < size; ++j) {
+        r = r * 6364136223846793005ul + 1442695040888963407ul;
+        list.add(r >> 33);
+      }
+    }
+    // the hash table's time includes gathering its keys
+    auto start = high_resolution_clock::now();
+    if (type == ARRAYLIST)
+      list.sort(threads);
+    else
+      collection.sort(list, threads);
+    auto end = high_resolution_clock::now();
+    for (size_t j = 1; j < list.size(); ++j)
+      assert(!(list[j] < list[j - 1]));
+    times[i] = duration_cast<microseconds>(end - start).count();
+  }
+  return sum(times, ITERATIONS) / (ITERATIONS*1000.0);
+}
+
+
+double key_sort(pair<string,int> array[], size_t size, int algorithm)
+{
+  unsigned long times[ITERATIONS];
+  for (size_t i = 0; i < ITERATIONS; ++i) {
+    ArrayList<string> list;
+    for (size_t j = 0; j < size; ++j)
+      list.add(array[j].first);
+    auto start = high_resolution_clock::now();
+    if (algorithm == QUICKSORT)
+      list.quick_sort();
+    else if (algorithm == INTROSORT)
+      list.intro_sort();
+    else if (algorithm == MERGESORT)
+      list.merge_sort();
+    else
+      list.radix_sort();
+    auto end = high_resolution_clock::now();
+    for (size_t j = 1; j < size; ++j)
+      assert(!(list[j] < list[j - 1]));
+    times[i] = duration_cast<microseconds>(end - start).count();
+  }
+  return sum(times, ITERATIONS) / (ITERATIONS*1000.0);
+}
+
+
+template<typename K>
+void add_remove(pair<string,int> array[], size_t size, int type,
+                double& add_time, double& remove_time)
+{
+  // int keys are the array positions, scrambled (multiplying by a
+  // prime mod size permutes them)
+  K* keys = new K[size];
+  for (size_t i = 0; i < size; ++i) {
+    if constexpr (is_same<K,string>::value)
+      keys[i] = array[i].first;
+    else
+      keys[i] = (i * 2654435761ul) % size;
+  }
+  Collection<K,int>* collection;
+  if (type == ARRAYLIST)
+    collection = new ArrayListCollection<K,int>;
+  else
+    collection = new BinSearchCollection<K,int>;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < size; ++i)
+    collection->add(keys[i], i);
+  auto end = high_resolution_clock::now();
+  add_time = duration_cast<nanoseconds>(end - start).count() / (size*1.0);
+  assert(collection->size() == size);
+  // remove in a different order than added
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < size; ++i)
+    collection->remove(keys[(i * 7919) % size]);
+  end = high_resolution_clock::now();
+  remove_time = duration_cast<nanoseconds>(end - start).count() / (size*1.0);
+  assert(collection->size() == 0);
+  delete collection;
+  delete [] keys;
+}
+
+
+double list_scan(pair<string,int> array[], size_t size, int method)
+{
+  unsigned long times[ITERATIONS];
+  ArrayList<string> list;
+  for (size_t i = 0; i < size; ++i)
+    list.add(array[i].first);
+  size_t expected = 0;
+  for (size_t i = 0; i < ITERATIONS; ++i) {
+    // total the key lengths so every item is read
+    size_t total = 0;
+    auto start = high_resolution_clock::now();
+    if (method == GET_SCAN) {
+      for (size_t j = 0; j < list.size(); ++j) {
+        string item;
+        list.get(j, item);
+        total += item.size();
+      }
+    }
+    else if (method == INDEX_SCAN) {
+      for (size_t j = 0; j < list.size(); ++j)
+        total += list[j].size();
+    }
+    else if (method == RANGE_FOR_SCAN) {
+      for (const string& item : list)
+        total += item.size();
+    }
+    else {
+      ArraySlice<string> items = list.view();
+      for (size_t j = 0; j < items.size(); ++j)
+        total += items[j].size();
+    }
+    auto end = high_resolution_clock::now();
+    assert(i == 0 || total == expected);
+    expected = total;
+    times[i] = duration_cast<nanoseconds>(end - start).count();
+  }
+  return sum(times, ITERATIONS) / (ITERATIONS*1.0*size);
+}
+
+
+template<typename K, typename Result>
+double small_range(const BinSearchCollection<K,int>& collection,
+                   const ArrayList<K>& sorted_keys, size_t width)
+{
+  const size_t QUERIES = 200000;
+  // pick the ranges up front
+  size_t* starts = new size_t[QUERIES];
+  unsigned long r = 2166136261ul;
+  for (size_t i = 0; i < QUERIES; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    starts[i] = (r >> 17) % (sorted_keys.size() - width);
+  }
+  size_t total = 0;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < QUERIES; ++i) {
+    // a fresh result list per query, as callers use them
+    Result keys;
+    collection.find(sorted_keys[starts[i]], sorted_keys[starts[i] + width - 1], keys);
+    total += keys.size();
+  }
+  auto end = high_resolution_clock::now();
+  assert(total == QUERIES * width);
+  delete [] starts;
+  return duration_cast<nanoseconds>(end - start).count() / (QUERIES*1.0);
+}
+
+
+template<typename ListType>
+void append_latency(size_t size, double& avg, unsigned long& p50,
+                    unsigned long& p99, unsigned long& p9999, unsigned long& max)
+{
+  ListType list;
+  // time every append individually so the resizes are visible
+  unsigned long* times = new unsigned long[size];
+  for (size_t i = 0; i < size; ++i) {
+    auto start = high_resolution_clock::now();
+    if constexpr (is_same<ListType, ArrayList<string>>::value ||
+                  is_same<ListType, SegmentedList<string>>::value)
+      list.add("key");
+    else
+      list.add(i);
+    auto end = high_resolution_clock::now();
+    times[i] = duration_cast<nanoseconds>(end - start).count();
+  }
+  assert(list.size() == size);
+  std::sort(times, times + size);
+  avg = sum(times, size) / (size*1.0);
+  p50 = times[(size_t)((size - 1) * 0.5)];
+  p99 = times[(size_t)((size - 1) * 0.99)];
+  p9999 = times[(size_t)((size - 1) * 0.9999)];
+  max = times[size - 1];
+  delete [] times;
+}
+
+
+void linked_list_scans(pair<string,int> array[], size_t size, double& find1,
+                       double& find2, double& sort_time, double& remove_time)
+{
+  const size_t OPS = 20;
+  LinkedListCollection<string,int> collection;
+  for (size_t i = 0; i < size; ++i)
+    collection.add(array[i].first, array[i].second);
+  // keys spread over the whole list
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < OPS; ++i) {
+    int val;
+    collection.find(array[(i * size) / OPS].first, val);
+  }
+  auto end = high_resolution_clock::now();
+  find1 = duration_cast<microseconds>(end - start).count() / (OPS*1.0);
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < OPS; ++i) {
+    ArrayList<string> keys;
+    collection.find("B", "C", keys);
+  }
+  end = high_resolution_clock::now();
+  find2 = duration_cast<microseconds>(end - start).count() / (OPS*1.0);
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < ITERATIONS; ++i) {
+    ArrayList<string> keys;
+    collection.sort(keys);
+  }
+  end = high_resolution_clock::now();
+  sort_time = duration_cast<microseconds>(end - start).count() / (ITERATIONS*1.0);
+  start = high_resolution_clock::now();
+  for (size_t i = 0; i < OPS; ++i)
+    collection.remove(array[(i * size) / OPS].first);
+  end = high_resolution_clock::now();
+  remove_time = duration_cast<microseconds>(end - start).count() / (OPS*1.0);
+  assert(collection.size() == size - OPS);
+}
+
+
+template<typename ListType>
+void traverse_insert(size_t size, double& traverse_time, double& insert_time)
+{
+  const size_t INSERTS = 1000;
+  ListType list;
+  for (size_t i = 0; i < size; ++i)
+    list.add(i);
+  unsigned long times[ITERATIONS];
+  long expected = (long) size * (size - 1) / 2;
+  for (size_t i = 0; i < ITERATIONS; ++i) {
+    long total = 0;
+    auto start = high_resolution_clock::now();
+    for (const int& item : list)
+      total += item;
+    auto end = high_resolution_clock::now();
+    assert(total == expected);
+    times[i] = duration_cast<nanoseconds>(end - start).count();
+  }
+  traverse_time = sum(times, ITERATIONS) / (ITERATIONS*1.0*size);
+  unsigned long r = 2166136261ul;
+  auto start = high_resolution_clock::now();
+  for (size_t i = 0; i < INSERTS; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    list.add((r >> 17) % (list.size() + 1), -1);
+  }
+  auto end = high_resolution_clock::now();
+  insert_time = duration_cast<nanoseconds>(end - start).count() / (INSERTS*1.0);
+  assert(list.size() == size + INSERTS);
+}
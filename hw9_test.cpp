@@ -3,6 +3,7 @@
 // File: hw9_test.cpp
 // Date: Fall 2020
 // Desc: Unit tests for the red-black tree collection implementation
+//       and the other collection implementations built on top of it
 //----------------------------------------------------------------------
 
 
@@ -10,7 +11,26 @@
 #include <string>
 #include <gtest/gtest.h>
 #include "array_list.h"
+#include "small_array_list.h"
+#include "segmented_list.h"
+#include "linked_list.h"
+#include "linked_list_collection.h"
+#include "unrolled_linked_list.h"
 #include "rbt_collection.h"
+#include "concurrent_hash_table_collection.h"
+#include "cuckoo_hash_collection.h"
+#include "hybrid_collection.h"
+#include "hash_table_collection.h"
+#include "linked_hash_collection.h"
+#include "perfect_hash_collection.h"
+#include "cache_collection.h"
+#include "btree_collection.h"
+#include "eytzinger_collection.h"
+#include "bin_search_collection.h"
+#include "pma_collection.h"
+#include "bst_collection.h"
+#include "avl_collection.h"
+#include <thread>
 
 
 using namespace std;
@@ -48,6 +68,53 @@ bool member(const T& member_val, const List<T>& list)
   return false;
 }
 
+// Helper function to check find value for every key, and for missing
+// keys below, between and above them, under a search policy
+template<typename Search>
+void check_search_policy()
+{
+  //evenly spaced, then bunched up (skewed for interpolation)
+  BinSearchCollection<long,long,Search> c;
+  for (long i = 0; i < 1000; ++i) {
+    c.add(i * 10, i);
+  }
+  for (long i = 1; i <= 1000; ++i) {
+    c.add(10000 + i * i * i, -i);
+  }
+  long v;
+  ASSERT_EQ(false, c.find(-1, v));
+  for (long i = 0; i < 1000; ++i) {
+    ASSERT_EQ(true, c.find(i * 10, v));
+    ASSERT_EQ(i, v);
+    ASSERT_EQ(false, c.find(i * 10 + 5, v));
+  }
+  for (long i = 1; i <= 1000; ++i) {
+    ASSERT_EQ(true, c.find(10000 + i * i * i, v));
+    ASSERT_EQ(-i, v);
+    ASSERT_EQ(false, c.find(10000 + i * i * i + 1, v));
+  }
+  ArrayList<long> k;
+  c.find(95, 130, k);
+  ASSERT_EQ(4, k.size());
+  //fixed-width string keys
+  BinSearchCollection<string,int,Search> s;
+  BinSearchCollection<string,int,Search> empty;
+  for (char a = 'A'; a <= 'Z'; ++a) {
+    for (char b = 'A'; b <= 'Z'; b += 2) {
+      s.add(string(1, a) + b + "AA", a * 100 + b);
+    }
+  }
+  int w;
+  ASSERT_EQ(false, empty.find("AAAA", w));
+  ASSERT_EQ(true, s.find("AAAA", w));
+  ASSERT_EQ('A' * 100 + 'A', w);
+  ASSERT_EQ(true, s.find("ZYAA", w));
+  ASSERT_EQ('Z' * 100 + 'Y', w);
+  ASSERT_EQ(false, s.find("ZZAA", w));
+  ASSERT_EQ(false, s.find("MBAA", w));
+  ASSERT_EQ(false, s.find("", w));
+}
+
 
 // Test 1: Check add and size
 TEST(RBTCollectionTest, CorrectSize) {
@@ -492,6 +559,1322 @@ TEST(RBTCollectionTest, EmptyLists) {
   ASSERT_EQ(0, k.size());
 }
 
+//TEST 17: Tests basic add, find, remove and range on the concurrent table
+TEST(ConcurrentHashTableCollectionTest, SingleThreaded) {
+  ConcurrentHashTableCollection<string,int> c;
+  int v;
+  ASSERT_EQ(false, c.find("a", v));
+  c.add("b", 20);
+  c.add("a", 10);
+  c.add("c", 30);
+  ASSERT_EQ(3, c.size());
+  ASSERT_EQ(true, c.find("a", v));
+  ASSERT_EQ(10, v);
+  c.remove("a");
+  ASSERT_EQ(2, c.size());
+  ASSERT_EQ(false, c.find("a", v));
+  ArrayList<string> k;
+  c.find("b", "z", k);
+  ASSERT_EQ(2, k.size());
+  ArrayList<string> sorted_keys;
+  c.sort(sorted_keys);
+  string k1, k2;
+  sorted_keys.get(0, k1);
+  sorted_keys.get(1, k2);
+  ASSERT_EQ("b", k1);
+  ASSERT_EQ("c", k2);
+}
+
+//TEST 18: Tests adds, finds and removes from several threads at once,
+//including enough adds to force resizes while others are reading
+TEST(ConcurrentHashTableCollectionTest, MultiThreaded) {
+  ConcurrentHashTableCollection<int,int> c;
+  const int THREADS = 4;
+  const int PER_THREAD = 5000;
+  thread workers[THREADS];
+  for (int t = 0; t < THREADS; ++t) {
+    workers[t] = thread([&c, t]() {
+      for (int i = 0; i < PER_THREAD; ++i) {
+        int v;
+        c.add(t * PER_THREAD + i, i);
+        c.find(i, v);
+      }
+      //remove every other key this thread added
+      for (int i = 0; i < PER_THREAD; i += 2) {
+        c.remove(t * PER_THREAD + i);
+      }
+    });
+  }
+  for (int t = 0; t < THREADS; ++t) {
+    workers[t].join();
+  }
+  ASSERT_EQ(THREADS * PER_THREAD / 2, c.size());
+  int v;
+  ASSERT_EQ(true, c.find(PER_THREAD + 1, v));
+  ASSERT_EQ(1, v);
+  ASSERT_EQ(false, c.find(PER_THREAD + 2, v));
+  ConcurrentHashTableCollection<int,int> copy(c);
+  ASSERT_EQ(c.size(), copy.size());
+  //assigning each way at once must not deadlock
+  copy.add(-1, -1);
+  thread forward([&c, &copy]() {
+    for (int i = 0; i < 20; ++i) {
+      c = copy;
+    }
+  });
+  for (int i = 0; i < 20; ++i) {
+    copy = c;
+  }
+  forward.join();
+  ASSERT_EQ(c.size(), copy.size());
+}
+
+//TEST 19: Tests add, find, remove, range and sort on the cuckoo table
+TEST(CuckooHashCollectionTest, SimpleOperations) {
+  CuckooHashCollection<string,int> c;
+  int v;
+  ASSERT_EQ(false, c.find("a", v));
+  c.add("c", 30);
+  c.add("a", 10);
+  c.add("b", 20);
+  ASSERT_EQ(3, c.size());
+  ASSERT_EQ(true, c.find("b", v));
+  ASSERT_EQ(20, v);
+  ArrayList<string> k;
+  c.find("a", "b", k);
+  ASSERT_EQ(2, k.size());
+  c.remove("b");
+  c.remove("z");
+  ASSERT_EQ(2, c.size());
+  ASSERT_EQ(false, c.find("b", v));
+  ArrayList<string> sorted_keys;
+  c.sort(sorted_keys);
+  ASSERT_EQ(2, sorted_keys.size());
+  string k1;
+  sorted_keys.get(0, k1);
+  ASSERT_EQ("a", k1);
+}
+
+//TEST 20: Tests many adds (forcing displacements and resizes) followed
+//by removes, checking every key is still found in its bucket or stash
+TEST(CuckooHashCollectionTest, ManyKeys) {
+  CuckooHashCollection<int,int> c;
+  for (int i = 0; i < 20000; ++i) {
+    c.add(i * 7, i);
+  }
+  ASSERT_EQ(20000, c.size());
+  int v;
+  for (int i = 0; i < 20000; ++i) {
+    ASSERT_EQ(true, c.find(i * 7, v));
+    ASSERT_EQ(i, v);
+  }
+  ASSERT_EQ(false, c.find(1, v));
+  for (int i = 0; i < 20000; i += 2) {
+    c.remove(i * 7);
+  }
+  ASSERT_EQ(10000, c.size());
+  ASSERT_EQ(false, c.find(0, v));
+  ASSERT_EQ(true, c.find(7, v));
+  CuckooHashCollection<int,int> c2(c);
+  ASSERT_EQ(c.size(), c2.size());
+  ASSERT_EQ(true, c2.find(7, v));
+}
+
+//TEST 21: Tests that finds, ranges and sort agree after removes of
+//nodes with two children (which move shared nodes in the tree index)
+TEST(HybridCollectionTest, AddRemoveFindRange) {
+  HybridCollection<string,int> c;
+  string keys[7] = {"d", "b", "f", "a", "c", "e", "g"};
+  for (int i = 0; i < 7; ++i) {
+    c.add(keys[i], i);
+  }
+  ASSERT_EQ(7, c.size());
+  ASSERT_EQ(3, c.height());
+  c.remove("d");
+  c.remove("b");
+  c.remove("x");
+  ASSERT_EQ(5, c.size());
+  int v;
+  ASSERT_EQ(false, c.find("d", v));
+  ASSERT_EQ(true, c.find("f", v));
+  ASSERT_EQ(2, v);
+  ArrayList<string> range;
+  c.find("b", "f", range);
+  ASSERT_EQ(3, range.size());
+  string k;
+  range.get(0, k);
+  ASSERT_EQ("c", k);
+  range.get(2, k);
+  ASSERT_EQ("f", k);
+  ArrayList<string> sorted_keys;
+  c.sort(sorted_keys);
+  ASSERT_EQ(5, sorted_keys.size());
+  for (size_t i = 1; i < sorted_keys.size(); ++i) {
+    string k1, k2;
+    sorted_keys.get(i - 1, k1);
+    sorted_keys.get(i, k2);
+    ASSERT_LT(k1, k2);
+  }
+}
+
+//TEST 22: Tests the tree index stays balanced and both indexes stay in
+//sync across many adds and removes, and that copies are independent
+TEST(HybridCollectionTest, ManyKeys) {
+  HybridCollection<int,int> c;
+  for (int i = 0; i < 1000; ++i) {
+    c.add(i, i * 2);
+  }
+  ASSERT_GE(11, c.height());
+  for (int i = 0; i < 1000; i += 3) {
+    c.remove(i);
+  }
+  ASSERT_EQ(666, c.size());
+  ArrayList<int> range;
+  c.find(10, 20, range);
+  ASSERT_EQ(8, range.size());
+  HybridCollection<int,int> c2(c);
+  c2.remove(10);
+  int v;
+  ASSERT_EQ(true, c.find(10, v));
+  ASSERT_EQ(20, v);
+  ASSERT_EQ(false, c2.find(10, v));
+}
+
+//TEST 23: Tests the single-pass hash table statistics agree with the
+//table's contents (histogram totals, probe counts and resizes)
+TEST(HashTableCollectionTest, Statistics) {
+  HashTableCollection<string,int> c;
+  HashTableStats empty_stats;
+  c.statistics(empty_stats);
+  ASSERT_EQ(16, empty_stats.bucket_count);
+  ASSERT_EQ(16, empty_stats.empty_buckets);
+  ASSERT_EQ(0, empty_stats.max_chain_length);
+  for (int i = 0; i < 100; ++i) {
+    c.add(to_string(i), i);
+  }
+  HashTableStats stats;
+  c.statistics(stats);
+  ASSERT_EQ(4, stats.resize_count);
+  ASSERT_EQ(256, stats.bucket_count);
+  ASSERT_EQ(c.max_chain_length(), stats.max_chain_length);
+  ASSERT_EQ(c.min_chain_length(), stats.min_chain_length);
+  ASSERT_LE(1, stats.min_chain_length);
+  // every bucket and every key is counted exactly once
+  size_t buckets = 0, keys = 0, found = 0;
+  for (size_t i = 0; i < stats.chain_histogram.size(); ++i) {
+    size_t count;
+    stats.chain_histogram.get(i, count);
+    buckets += count;
+    keys += i * count;
+  }
+  for (size_t i = 0; i < stats.successful_probes.size(); ++i) {
+    size_t count;
+    stats.successful_probes.get(i, count);
+    found += count;
+  }
+  ASSERT_EQ(256, buckets);
+  ASSERT_EQ(100, keys);
+  ASSERT_EQ(100, found);
+  ASSERT_EQ(256 - stats.empty_buckets, (size_t)(100 / stats.avg_chain_length + 0.5));
+  ASSERT_LE(1.0, stats.avg_successful_probes);
+  ASSERT_DOUBLE_EQ(100 / 256.0, stats.avg_failed_probes);
+}
+
+//TEST 24: Tests keys come back in insertion order, including after
+//removes from the front, middle and end and after resizing
+TEST(LinkedHashCollectionTest, InsertionOrder) {
+  LinkedHashCollection<int,int> c;
+  for (int i = 0; i < 100; ++i) {
+    c.add(99 - i, i);
+  }
+  c.remove(99);
+  c.remove(50);
+  c.remove(0);
+  c.remove(1000);
+  ASSERT_EQ(97, c.size());
+  ArrayList<int> k;
+  c.keys(k);
+  ASSERT_EQ(97, k.size());
+  int expected = 98;
+  for (size_t i = 0; i < k.size(); ++i, --expected) {
+    if (expected == 50) {
+      --expected;
+    }
+    int key;
+    k.get(i, key);
+    ASSERT_EQ(expected, key);
+  }
+  int v;
+  ASSERT_EQ(true, c.find(98, v));
+  ASSERT_EQ(1, v);
+  ASSERT_EQ(false, c.find(50, v));
+  LinkedHashCollection<int,int> c2(c);
+  ArrayList<int> k2;
+  c2.keys(k2);
+  int first;
+  k2.get(0, first);
+  ASSERT_EQ(98, first);
+  ArrayList<int> sorted_keys;
+  c2.sort(sorted_keys);
+  sorted_keys.get(0, first);
+  ASSERT_EQ(1, first);
+}
+
+//TEST 25: Tests freezing a hash table finds every key with its value,
+//rejects missing keys, and ignores adds and removes
+TEST(PerfectHashCollectionTest, FreezeHashTable) {
+  HashTableCollection<string,int> source;
+  for (int i = 0; i < 5000; ++i) {
+    source.add(to_string(i), i);
+  }
+  PerfectHashCollection<string,int> c = freeze(source);
+  ASSERT_EQ(5000, c.size());
+  int v;
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_EQ(true, c.find(to_string(i), v));
+    ASSERT_EQ(i, v);
+  }
+  ASSERT_EQ(false, c.find("5000", v));
+  ASSERT_EQ(false, c.find("-1", v));
+  c.add("x", 1);
+  c.remove("0");
+  ASSERT_EQ(5000, c.size());
+  ASSERT_EQ(true, c.find("0", v));
+  ArrayList<string> k;
+  c.find("10", "11", k);
+  ASSERT_EQ(112, k.size());
+  PerfectHashCollection<string,int> c2(c);
+  ASSERT_EQ(true, c2.find("4999", v));
+  ASSERT_EQ(4999, v);
+}
+
+//TEST 26: Tests freezing empty, single-element and list-based
+//collections, and that a source holding a key twice is rejected
+TEST(PerfectHashCollectionTest, SmallCollections) {
+  RBTCollection<string,int> source;
+  PerfectHashCollection<string,int> empty = freeze(source);
+  int v;
+  ASSERT_EQ(0, empty.size());
+  ASSERT_EQ(false, empty.find("a", v));
+  source.add("a", 10);
+  PerfectHashCollection<string,int> one = freeze(source);
+  ASSERT_EQ(1, one.size());
+  ASSERT_EQ(true, one.find("a", v));
+  ASSERT_EQ(10, v);
+  ASSERT_EQ(false, one.find("b", v));
+  //list-based sources hand over their pairs in one scan
+  BinSearchCollection<string,int> sorted;
+  sorted.add("b", 2);
+  sorted.add("a", 1);
+  PerfectHashCollection<string,int> two = freeze(sorted);
+  ASSERT_EQ(2, two.size());
+  ASSERT_EQ(true, two.find("b", v));
+  ASSERT_EQ(2, v);
+  LinkedListCollection<string,int> twice;
+  twice.add("a", 1);
+  twice.add("b", 2);
+  twice.add("a", 3);
+  ASSERT_THROW(freeze(twice), invalid_argument);
+}
+
+//TEST 27: Tests the LRU cache evicts the least recently used key (where
+//a find counts as a use) and keeps the hit, miss and eviction counters
+TEST(CacheCollectionTest, LRUEviction) {
+  CacheCollection<string,int> c(3);
+  c.add("a", 1);
+  c.add("b", 2);
+  c.add("c", 3);
+  int v;
+  ASSERT_EQ(true, c.find("a", v));
+  c.add("d", 4);
+  ASSERT_EQ(3, c.size());
+  ASSERT_EQ(false, c.find("b", v));
+  ASSERT_EQ(true, c.find("a", v));
+  ASSERT_EQ(true, c.find("c", v));
+  ASSERT_EQ(true, c.find("d", v));
+  ASSERT_EQ(1, c.evictions());
+  ASSERT_EQ(4, c.hits());
+  ASSERT_EQ(1, c.misses());
+  ASSERT_DOUBLE_EQ(0.8, c.hit_ratio());
+  // re-adding a cached key replaces its value without evicting
+  c.add("c", 30);
+  ASSERT_EQ(true, c.find("c", v));
+  ASSERT_EQ(30, v);
+  ASSERT_EQ(1, c.evictions());
+  c.remove("a");
+  ASSERT_EQ(2, c.size());
+  ArrayList<string> k;
+  c.keys(k);
+  string first;
+  k.get(0, first);
+  ASSERT_EQ("c", first);
+  CacheCollection<string,int> c2(c);
+  c2.add("e", 5);
+  c2.add("f", 6);
+  ASSERT_EQ(false, c2.find("d", v));
+  ASSERT_EQ(true, c.find("d", v));
+}
+
+//TEST 28: Tests the CLOCK cache gives referenced keys a second chance,
+//and that a new key isn't evicted before the older unreferenced ones
+TEST(CacheCollectionTest, ClockEviction) {
+  CacheCollection<string,int> c(3, CacheCollection<string,int>::CLOCK);
+  c.add("a", 1);
+  c.add("b", 2);
+  c.add("c", 3);
+  int v;
+  ASSERT_EQ(true, c.find("a", v));
+  ASSERT_EQ(true, c.find("c", v));
+  // hand clears a's bit, then evicts unreferenced b
+  c.add("d", 4);
+  ASSERT_EQ(3, c.size());
+  ASSERT_EQ(false, c.find("b", v));
+  ASSERT_EQ(true, c.find("a", v));
+  ASSERT_EQ(true, c.find("d", v));
+  for (int i = 0; i < 100; ++i) {
+    c.add(to_string(i), i);
+  }
+  ASSERT_EQ(3, c.size());
+  ASSERT_EQ(101, c.evictions());
+  c.remove("99");
+  ASSERT_EQ(2, c.size());
+  //sort doesn't count as a use, so it checks keys without setting bits
+  CacheCollection<string,int> s(3, CacheCollection<string,int>::CLOCK);
+  s.add("a", 1);
+  s.add("b", 2);
+  s.add("c", 3);
+  s.add("x", 4);
+  s.add("y", 5);
+  ArrayList<string> cached;
+  s.sort(cached);
+  ASSERT_EQ(3, cached.size());
+  ASSERT_EQ("c", cached[0]);
+  ASSERT_EQ("x", cached[1]);
+  ASSERT_EQ("y", cached[2]);
+  s.add("z", 6);
+  ArrayList<string> cached2;
+  s.sort(cached2);
+  ASSERT_EQ("x", cached2[0]);
+  ASSERT_EQ("y", cached2[1]);
+  ASSERT_EQ("z", cached2[2]);
+}
+
+//TEST 29: Tests B+ tree add, find, range, sort and remove with string
+//keys (8 keys per node), enough to split and merge internal nodes
+TEST(BTreeCollectionTest, StringKeys) {
+  BTreeCollection<string,int> c;
+  for (int i = 0; i < 2000; ++i) {
+    c.add(to_string((i * 7919) % 2000 + 10000), i);
+  }
+  ASSERT_EQ(2000, c.size());
+  ASSERT_LE(4, c.height());
+  int v;
+  ASSERT_EQ(true, c.find("10000", v));
+  ASSERT_EQ(false, c.find("9999", v));
+  ArrayList<string> range;
+  c.find("10100", "10199", range);
+  ASSERT_EQ(100, range.size());
+  string first;
+  range.get(0, first);
+  ASSERT_EQ("10100", first);
+  for (int i = 10000; i < 12000; i += 2) {
+    c.remove(to_string(i));
+  }
+  c.remove("x");
+  ASSERT_EQ(1000, c.size());
+  ArrayList<string> sorted_keys;
+  c.sort(sorted_keys);
+  ASSERT_EQ(1000, sorted_keys.size());
+  for (size_t i = 1; i < sorted_keys.size(); ++i) {
+    string k1, k2;
+    sorted_keys.get(i - 1, k1);
+    sorted_keys.get(i, k2);
+    ASSERT_LT(k1, k2);
+  }
+  for (int i = 10001; i < 12000; i += 2) {
+    ASSERT_EQ(true, c.find(to_string(i), v));
+    c.remove(to_string(i));
+  }
+  ASSERT_EQ(0, c.size());
+  ASSERT_EQ(0, c.height());
+}
+
+//TEST 30: Tests the SIMD in-node search paths for int and long keys
+TEST(BTreeCollectionTest, IntegerKeys) {
+  BTreeCollection<int,int> c1;
+  BTreeCollection<long,int> c2;
+  for (int i = 0; i < 10000; ++i) {
+    int k = (i * 7919) % 10000 - 5000;
+    c1.add(k, i);
+    c2.add(k, i);
+  }
+  int v;
+  for (int k = -5000; k < 5000; ++k) {
+    ASSERT_EQ(true, c1.find(k, v));
+    ASSERT_EQ(true, c2.find(k, v));
+  }
+  ASSERT_EQ(false, c1.find(5000, v));
+  ASSERT_EQ(false, c2.find(-5001, v));
+  ArrayList<int> r1;
+  c1.find(-10, 10, r1);
+  ASSERT_EQ(21, r1.size());
+  ArrayList<long> r2;
+  c2.find(4990, 6000, r2);
+  ASSERT_EQ(10, r2.size());
+  for (int k = -5000; k < 5000; k += 3) {
+    c1.remove(k);
+  }
+  ASSERT_EQ(6666, c1.size());
+  ASSERT_EQ(false, c1.find(-5000, v));
+  ASSERT_EQ(true, c1.find(-4999, v));
+  BTreeCollection<int,int> c3(c1);
+  ASSERT_EQ(6666, c3.size());
+  ASSERT_EQ(true, c3.find(-4999, v));
+}
+
+//TEST 31: Tests an Eytzinger layout finds every key with its value
+//for sizes that do and don't fill the last level, and rejects keys
+//before, between and after the stored keys
+TEST(EytzingerCollectionTest, FindValues) {
+  for (int n = 0; n < 70; ++n) {
+    RBTCollection<int,int> source;
+    for (int i = 0; i < n; ++i) {
+      source.add(2 * i, i);
+    }
+    EytzingerCollection<int,int> c(source);
+    ASSERT_EQ(n, c.size());
+    int v;
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(true, c.find(2 * i, v));
+      ASSERT_EQ(i, v);
+      ASSERT_EQ(false, c.find(2 * i + 1, v));
+    }
+    ASSERT_EQ(false, c.find(-1, v));
+    ArrayList<int> sorted;
+    c.sort(sorted);
+    ASSERT_EQ(n, sorted.size());
+    for (int i = 0; i < n; ++i) {
+      sorted.get(i, v);
+      ASSERT_EQ(2 * i, v);
+    }
+  }
+}
+
+//TEST 32: Tests Eytzinger range finds return keys in order, and that
+//adds and removes are ignored
+TEST(EytzingerCollectionTest, RangeFind) {
+  HashTableCollection<int,int> source;
+  for (int i = 0; i < 1000; ++i) {
+    source.add(i, i * 10);
+  }
+  EytzingerCollection<int,int> c(source);
+  ArrayList<int> k;
+  c.find(100, 199, k);
+  ASSERT_EQ(100, k.size());
+  for (int i = 0; i < 100; ++i) {
+    int key;
+    k.get(i, key);
+    ASSERT_EQ(100 + i, key);
+  }
+  ArrayList<int> none;
+  c.find(1000, 2000, none);
+  ASSERT_EQ(0, none.size());
+  ArrayList<int> all;
+  c.find(-5, 5000, all);
+  ASSERT_EQ(1000, all.size());
+  c.add(5000, 1);
+  c.remove(0);
+  int v;
+  ASSERT_EQ(1000, c.size());
+  ASSERT_EQ(true, c.find(0, v));
+  EytzingerCollection<int,int> c2(c);
+  ASSERT_EQ(true, c2.find(999, v));
+  ASSERT_EQ(9990, v);
+}
+
+//TEST 33: Tests the binary search collection keeps keys and values
+//paired through out-of-order adds, duplicate adds, and removes
+TEST(BinSearchCollectionTest, KeysAndValuesStayPaired) {
+  BinSearchCollection<int,string> c;
+  for (int i = 0; i < 100; ++i) {
+    int key = (i * 37) % 100;
+    c.add(key, to_string(key));
+  }
+  c.add(5, "duplicate");
+  ASSERT_EQ(100, c.size());
+  for (int i = 0; i < 100; i += 2) {
+    c.remove(i);
+  }
+  c.remove(1000);
+  ASSERT_EQ(50, c.size());
+  string v;
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(i % 2 == 1, c.find(i, v));
+    if (i % 2 == 1) {
+      ASSERT_EQ(to_string(i), v);
+    }
+  }
+  ArrayList<int> k;
+  c.find(10, 20, k);
+  ASSERT_EQ(5, k.size());
+  int key;
+  k.get(0, key);
+  ASSERT_EQ(11, key);
+  ArrayList<int> none;
+  c.find(100, 200, none);
+  ASSERT_EQ(0, none.size());
+}
+
+//TEST 34: Tests the packed memory array through growing with
+//out-of-order adds and shrinking with removes, checking every key,
+//value and the sorted order along the way
+TEST(PMACollectionTest, GrowAndShrink) {
+  PMACollection<int,int> c;
+  const int n = 5000;
+  for (int i = 0; i < n; ++i) {
+    int key = (i * 7919) % n;
+    c.add(key, -key);
+  }
+  c.add(0, 1);
+  ASSERT_EQ(n, c.size());
+  int v;
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(true, c.find(i, v));
+    ASSERT_EQ(-i, v);
+  }
+  ASSERT_EQ(false, c.find(n, v));
+  for (int i = 0; i < n; ++i) {
+    if (i % 10 != 0) {
+      c.remove(i);
+    }
+  }
+  c.remove(n);
+  ASSERT_EQ(n / 10, c.size());
+  ArrayList<int> sorted;
+  c.sort(sorted);
+  ASSERT_EQ(n / 10, sorted.size());
+  for (int i = 0; i < n / 10; ++i) {
+    sorted.get(i, v);
+    ASSERT_EQ(i * 10, v);
+  }
+  ArrayList<int> k;
+  c.find(95, 151, k);
+  ASSERT_EQ(6, k.size());
+  k.get(0, v);
+  ASSERT_EQ(100, v);
+  for (int i = 0; i < n; i += 10) {
+    c.remove(i);
+  }
+  ASSERT_EQ(0, c.size());
+  ASSERT_EQ(false, c.find(0, v));
+}
+
+//TEST 35: Tests copying a packed memory array and range finds at the
+//ends of the key space
+TEST(PMACollectionTest, CopyAndRanges) {
+  PMACollection<string,int> c;
+  ArrayList<string> k;
+  c.find("a", "z", k);
+  ASSERT_EQ(0, k.size());
+  for (int i = 0; i < 300; ++i) {
+    c.add(to_string(i), i);
+  }
+  PMACollection<string,int> c2(c);
+  c.remove("5");
+  ASSERT_EQ(299, c.size());
+  ASSERT_EQ(300, c2.size());
+  int v;
+  ASSERT_EQ(true, c2.find("5", v));
+  ASSERT_EQ(5, v);
+  c2.find("", "0", k);
+  ASSERT_EQ(1, k.size());
+  ArrayList<string> k2;
+  c2.find("99", "zz", k2);
+  ASSERT_EQ(1, k2.size());
+  ArrayList<string> k3;
+  c2.find("", "zz", k3);
+  ASSERT_EQ(300, k3.size());
+}
+
+//TEST 36: Tests batch adds into a binary search collection merge with
+//the existing keys, skipping keys already present and keeping the last
+//pair for a repeated key
+TEST(BatchAddTest, BinSearchMerge) {
+  BinSearchCollection<int,int> c;
+  c.add(10, 100);
+  c.add(30, 300);
+  ArrayList<pair<int,int>> batch;
+  for (int i = 40; i >= 0; i -= 5) {
+    batch.add(pair<int,int>(i, i * 10 + 1));
+  }
+  batch.add(pair<int,int>(5, 59));
+  c.add_batch(batch);
+  ASSERT_EQ(9, c.size());
+  int v;
+  ASSERT_EQ(true, c.find(10, v));
+  ASSERT_EQ(100, v);
+  ASSERT_EQ(true, c.find(5, v));
+  ASSERT_EQ(59, v);
+  ASSERT_EQ(true, c.find(35, v));
+  ASSERT_EQ(351, v);
+  ArrayList<int> sorted;
+  c.sort(sorted);
+  for (int i = 0; i < 9; ++i) {
+    sorted.get(i, v);
+    ASSERT_EQ(i * 5, v);
+  }
+  ArrayList<pair<int,int>> empty;
+  c.add_batch(empty);
+  ASSERT_EQ(9, c.size());
+}
+
+//TEST 37: Tests batch adds into the trees leave them balanced (and a
+//valid red-black tree) with every key findable
+TEST(BatchAddTest, TreesRebuildBalanced) {
+  BSTCollection<int,int> bst;
+  AVLCollection<int,int> avl;
+  RBTCollection<int,int> rbt;
+  for (int i = 0; i < 10; ++i) {
+    bst.add(i, i);
+    avl.add(i, i);
+    rbt.add(i, i);
+  }
+  for (int round = 1; round <= 5; ++round) {
+    ArrayList<pair<int,int>> batch;
+    for (int i = 0; i < 200 * round; ++i) {
+      batch.add(pair<int,int>((i * 7) % (200 * round), i));
+    }
+    bst.add_batch(batch);
+    avl.add_batch(batch);
+    rbt.add_batch(batch);
+    ASSERT_EQ(200 * round, rbt.size());
+    ASSERT_EQ(true, rbt.valid_rbt());
+  }
+  ASSERT_EQ(1000, bst.size());
+  ASSERT_EQ(1000, avl.size());
+  //a perfectly balanced tree of 1000 nodes has height 10
+  ASSERT_EQ(10, bst.height());
+  ASSERT_EQ(10, avl.height());
+  ASSERT_EQ(10, rbt.height());
+  int v;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(true, bst.find(i, v));
+    ASSERT_EQ(true, avl.find(i, v));
+    ASSERT_EQ(true, rbt.find(i, v));
+  }
+  ASSERT_EQ(true, rbt.find(5, v));
+  ASSERT_EQ(5, v);
+  //the trees still take single adds afterwards
+  avl.add(1000, 0);
+  rbt.add(1000, 0);
+  ASSERT_EQ(true, rbt.valid_rbt());
+  ASSERT_EQ(1001, avl.size());
+  ASSERT_EQ(true, avl.find(1000, v));
+}
+
+//TEST 38: Tests find value gives the same answers under every binary
+//search collection search policy
+TEST(BinSearchCollectionTest, SearchPolicies) {
+  check_search_policy<BranchySearch>();
+  check_search_policy<BranchlessSearch>();
+  check_search_policy<KarySearch>();
+  check_search_policy<InterpolationSearch>();
+}
+
+//TEST 39: Tests range views and counts on a binary search collection
+//at the ends, in the middle, and for empty ranges
+TEST(BinSearchCollectionTest, RangeSliceAndCount) {
+  BinSearchCollection<int,int> c;
+  ArraySlice<int> none = c.range(0, 100);
+  ASSERT_EQ(0, none.size());
+  ASSERT_EQ(0, c.count(0, 100));
+  for (int i = 0; i < 100; ++i) {
+    c.add(i * 2, i);
+  }
+  ArraySlice<int> s = c.range(9, 21);
+  ASSERT_EQ(6, s.size());
+  ASSERT_EQ(10, s[0]);
+  ASSERT_EQ(20, s[5]);
+  int sum = 0;
+  for (const int& key : s) {
+    sum += key;
+  }
+  ASSERT_EQ(90, sum);
+  int key;
+  ASSERT_EQ(false, s.get(6, key));
+  ASSERT_EQ(6, c.count(9, 21));
+  ASSERT_EQ(6, c.count(10, 20));
+  ASSERT_EQ(100, c.count(-10, 1000));
+  ASSERT_EQ(100, c.range(0, 198).size());
+  ASSERT_EQ(1, c.count(198, 500));
+  ASSERT_EQ(0, c.count(199, 500));
+  ASSERT_EQ(0, c.count(3, 3));
+  ASSERT_EQ(1, c.count(4, 4));
+  ASSERT_EQ(0, c.count(50, 10));
+  ASSERT_EQ(true, c.range(50, 10).empty());
+}
+
+//TEST 40: Tests collections used as key-only sets (NoValue values)
+//still add, find, remove and range find keys
+TEST(KeySetTest, NoValueCollections) {
+  BinSearchCollection<int,NoValue> bin;
+  HashTableCollection<int,NoValue> hash;
+  BSTCollection<int,NoValue> bst;
+  AVLCollection<int,NoValue> avl;
+  Collection<int,NoValue>* sets[] = {&bin, &hash, &bst, &avl};
+  for (Collection<int,NoValue>* c : sets) {
+    for (int i = 0; i < 200; ++i) {
+      c->add((i * 37) % 200, NoValue());
+    }
+    for (int i = 0; i < 200; i += 2) {
+      c->remove(i);
+    }
+    ASSERT_EQ(100, c->size());
+    NoValue v;
+    for (int i = 0; i < 200; ++i) {
+      ASSERT_EQ(i % 2 == 1, c->find(i, v));
+    }
+    ArrayList<int> k;
+    c->find(10, 20, k);
+    ASSERT_EQ(5, k.size());
+  }
+  RBTCollection<int,NoValue> rbt;
+  for (int i = 0; i < 200; ++i) {
+    rbt.add((i * 37) % 200, NoValue());
+  }
+  ASSERT_EQ(true, rbt.valid_rbt());
+  NoValue v;
+  ASSERT_EQ(true, rbt.find(199, v));
+  ASSERT_EQ(false, rbt.find(200, v));
+  ArrayList<pair<int,NoValue>> batch;
+  for (int i = 0; i < 50; ++i) {
+    batch.add(pair<int,NoValue>(i * 2 + 1000, NoValue()));
+  }
+  bin.add_batch(batch);
+  rbt.add_batch(batch);
+  ASSERT_EQ(150, bin.size());
+  ASSERT_EQ(250, rbt.size());
+  ASSERT_EQ(true, rbt.valid_rbt());
+}
+
+//TEST 41: Tests that sort (intro sort) orders sorted, reversed,
+//duplicate-heavy, and random lists, including sizes around the
+//insertion sort cutoff
+TEST(ArrayListTest, IntroSort) {
+  size_t sizes[] = {0, 1, 2, 15, 16, 17, 100, 5000};
+  for (size_t n : sizes) {
+    ArrayList<int> lists[4];
+    unsigned long r = 2166136261ul;
+    for (size_t i = 0; i < n; ++i) {
+      r = r * 6364136223846793005ul + 1442695040888963407ul;
+      lists[0].add(i);
+      lists[1].add(n - i);
+      lists[2].add((r >> 33) % 3);
+      lists[3].add(r >> 33);
+    }
+    for (ArrayList<int>& list : lists) {
+      long total = 0;
+      for (size_t i = 0; i < n; ++i) {
+        total += list[i];
+      }
+      list.sort();
+      ASSERT_EQ(n, list.size());
+      for (size_t i = 1; i < n; ++i) {
+        ASSERT_LE(list[i - 1], list[i]);
+      }
+      for (size_t i = 0; i < n; ++i) {
+        total -= list[i];
+      }
+      ASSERT_EQ(0, total);
+    }
+  }
+  ArrayList<string> words;
+  words.add("pear");
+  words.add("apple");
+  words.add("fig");
+  words.add("apple");
+  words.intro_sort();
+  string w;
+  words.get(0, w);
+  ASSERT_EQ("apple", w);
+  words.get(3, w);
+  ASSERT_EQ("pear", w);
+}
+
+//TEST 42: Tests that merge sort keeps equal items in their original
+//order, on runs short enough for insertion sort and long enough to merge
+struct Tagged {
+  int key;
+  int tag;
+  bool operator<(const Tagged& rhs) const {return key < rhs.key;}
+  bool operator>(const Tagged& rhs) const {return key > rhs.key;}
+};
+
+TEST(ArrayListTest, StableMergeSort) {
+  size_t sizes[] = {0, 1, 10, 16, 17, 1000, 20000};
+  for (size_t n : sizes) {
+    ArrayList<Tagged> list;
+    unsigned long r = 2166136261ul;
+    for (size_t i = 0; i < n; ++i) {
+      r = r * 6364136223846793005ul + 1442695040888963407ul;
+      list.add(Tagged{(int) ((r >> 33) % 7), (int) i});
+    }
+    list.merge_sort();
+    ASSERT_EQ(n, list.size());
+    for (size_t i = 1; i < n; ++i) {
+      ASSERT_LE(list[i - 1].key, list[i].key);
+      if (list[i - 1].key == list[i].key) {
+        ASSERT_LT(list[i - 1].tag, list[i].tag);
+      }
+    }
+  }
+  ArrayList<string> words;
+  for (int i = 0; i < 100; ++i) {
+    words.add(to_string((i * 37) % 100));
+  }
+  words.merge_sort();
+  string w;
+  words.get(0, w);
+  ASSERT_EQ("0", w);
+  words.get(99, w);
+  ASSERT_EQ("99", w);
+}
+
+//TEST 43: Tests multi-threaded sorts of lists and hash table keys,
+//including lists too short to split and thread counts that don't
+//divide evenly
+TEST(ArrayListTest, ThreadedSort) {
+  size_t sizes[] = {0, 5, 10000, 50001};
+  size_t thread_counts[] = {0, 1, 2, 3, 8};
+  for (size_t n : sizes) {
+    for (size_t threads : thread_counts) {
+      ArrayList<int> list;
+      unsigned long r = 2166136261ul + threads;
+      for (size_t i = 0; i < n; ++i) {
+        r = r * 6364136223846793005ul + 1442695040888963407ul;
+        list.add((r >> 33) % 1000);
+      }
+      list.sort(threads);
+      ASSERT_EQ(n, list.size());
+      for (size_t i = 1; i < n; ++i) {
+        ASSERT_LE(list[i - 1], list[i]);
+      }
+    }
+  }
+  //the pieces of string and negative integer lists are radix sorted
+  ArrayList<string> strings;
+  ArrayList<long> longs;
+  unsigned long r = 2166136261ul;
+  for (size_t i = 0; i < 30000; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    strings.add(to_string(r >> 40));
+    longs.add((long) r);
+  }
+  strings.sort(3);
+  longs.sort(3);
+  for (size_t i = 1; i < 30000; ++i) {
+    ASSERT_LE(strings[i - 1], strings[i]);
+    ASSERT_LE(longs[i - 1], longs[i]);
+  }
+  HashTableCollection<int,int> c;
+  for (int i = 0; i < 30000; ++i) {
+    c.add((i * 7919) % 30000, i);
+  }
+  ArrayList<int> sorted_keys;
+  c.sort(sorted_keys, 4);
+  ASSERT_EQ(30000, sorted_keys.size());
+  for (int i = 0; i < 30000; ++i) {
+    ASSERT_EQ(i, sorted_keys[i]);
+  }
+}
+
+//TEST 44: Tests radix sort (and sort, which picks it for these types)
+//on signed and unsigned integers and on strings of mixed lengths
+TEST(ArrayListTest, RadixSort) {
+  ArrayList<long> longs;
+  ArrayList<unsigned int> uints;
+  ArrayList<string> strings;
+  unsigned long r = 2166136261ul;
+  for (size_t i = 0; i < 5000; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    longs.add((long) r);
+    uints.add(r >> 32);
+    string str = "";
+    for (size_t j = 0; j < (r >> 20) % 6; ++j) {
+      str += (char) ('A' + (r >> (j * 3)) % 4);
+    }
+    strings.add(str);
+  }
+  longs.add(0);
+  longs.add(-1);
+  strings.add("\xff");
+  longs.radix_sort();
+  uints.sort();
+  strings.sort();
+  for (size_t i = 1; i < longs.size(); ++i) {
+    ASSERT_LE(longs[i - 1], longs[i]);
+  }
+  for (size_t i = 1; i < uints.size(); ++i) {
+    ASSERT_LE(uints[i - 1], uints[i]);
+  }
+  for (size_t i = 1; i < strings.size(); ++i) {
+    ASSERT_LE(strings[i - 1], strings[i]);
+  }
+  ASSERT_EQ(5002, longs.size());
+  ASSERT_EQ(5001, strings.size());
+  ASSERT_EQ("", strings[0]);
+  ASSERT_EQ("\xff", strings[5000]);
+  //the list still works after the radix sort swaps its array
+  longs.add(7);
+  ASSERT_EQ(5003, longs.size());
+  ASSERT_EQ(7, longs[5002]);
+  ArrayList<int> few;
+  few.add(3);
+  few.add(-2);
+  few.sort();
+  ASSERT_EQ(-2, few[0]);
+}
+
+//TEST 45: Tests reserve, shrink_to_fit, copies, and shifting adds and
+//removes, for trivially copyable items and for strings, that unused
+//capacity holds no items, and that a failed allocation throws
+struct Counted {
+  static int live;
+  int value;
+  Counted() : value(0) {live++;}
+  Counted(int v) : value(v) {live++;}
+  Counted(const Counted& rhs) : value(rhs.value) {live++;}
+  ~Counted() {live--;}
+  Counted& operator=(const Counted& rhs) {value = rhs.value; return *this;}
+  bool operator<(const Counted& rhs) const {return value < rhs.value;}
+  bool operator>(const Counted& rhs) const {return value > rhs.value;}
+};
+int Counted::live = 0;
+
+TEST(ArrayListTest, StorageGrowth) {
+  ArrayList<int> ints;
+  ints.reserve(1000);
+  for (int i = 0; i < 1000; ++i) {
+    ints.add(0, i);
+  }
+  ASSERT_EQ(true, ints.add(1000, -1));
+  ASSERT_EQ(false, ints.add(1002, -1));
+  ASSERT_EQ(999, ints[0]);
+  ASSERT_EQ(-1, ints[1000]);
+  ASSERT_EQ(true, ints.remove(0));
+  ASSERT_EQ(998, ints[0]);
+  ints.shrink_to_fit();
+  ints.add(ints[0]);
+  ASSERT_EQ(998, ints[1000]);
+  ArrayList<int> copy(ints);
+  ArrayList<int> assigned;
+  assigned.add(5);
+  assigned = copy;
+  assigned = assigned;
+  ASSERT_EQ(1001, assigned.size());
+  for (size_t i = 0; i < ints.size(); ++i) {
+    ASSERT_EQ(ints[i], assigned[i]);
+  }
+  //a failed allocation throws and leaves the list as it was
+  ASSERT_THROW(assigned.reserve((size_t) 1 << 60), bad_alloc);
+  ASSERT_EQ(1001, assigned.size());
+  ASSERT_EQ(ints[1000], assigned[1000]);
+  ArrayList<string> strs;
+  for (int i = 0; i < 100; ++i) {
+    strs.add(i / 2, to_string(i));
+  }
+  strs.add(0, strs[99]);
+  ASSERT_EQ(101, strs.size());
+  ASSERT_EQ(strs[100], strs[0]);
+  strs.remove(0);
+  strs.remove(50);
+  strs.shrink_to_fit();
+  ArrayList<string> strs_copy = strs;
+  ASSERT_EQ(99, strs_copy.size());
+  ASSERT_EQ(strs[98], strs_copy[98]);
+  ASSERT_THROW(strs_copy.reserve((size_t) 1 << 58), bad_alloc);
+  ASSERT_EQ(strs[98], strs_copy[98]);
+  {
+    ArrayList<Counted> counted;
+    counted.reserve(100);
+    ASSERT_EQ(0, Counted::live);
+    for (int i = 0; i < 50; ++i) {
+      counted.add(Counted(i));
+    }
+    counted.add(10, Counted(-1));
+    counted.remove(0);
+    ASSERT_EQ(50, Counted::live);
+    ASSERT_EQ(-1, counted[9].value);
+    counted.shrink_to_fit();
+    ASSERT_EQ(50, Counted::live);
+  }
+  ASSERT_EQ(0, Counted::live);
+}
+
+//TEST 46: Tests reference access: at (checked), begin/end and view
+TEST(ArrayListTest, ReferenceAccess) {
+  ArrayList<string> list;
+  ASSERT_EQ(list.begin(), list.end());
+  ASSERT_EQ(0, list.view().size());
+  ASSERT_THROW(list.at(0), out_of_range);
+  list.add("a");
+  list.add("b");
+  list.add("c");
+  list.at(1) += "b";
+  ASSERT_EQ("bb", list[1]);
+  const ArrayList<string>& same = list;
+  ASSERT_EQ("c", same.at(2));
+  ASSERT_THROW(same.at(3), out_of_range);
+  string all = "";
+  for (string& item : list) {
+    item += "!";
+  }
+  for (const string& item : same) {
+    all += item;
+  }
+  ASSERT_EQ("a!bb!c!", all);
+  ArraySlice<string> v = list.view();
+  ASSERT_EQ(3, v.size());
+  ASSERT_EQ(&list[0], &v[0]);
+  ASSERT_EQ(list.end(), v.end());
+}
+
+//TEST 47: Tests a SmallArrayList below and above its inline capacity,
+//as a range find result, copied, sorted and shrunk back
+TEST(SmallArrayListTest, InlineAndOverflow) {
+  SmallArrayList<int,4> ints;
+  for (int i = 9; i >= 0; --i) {
+    ints.add(i);
+  }
+  ints.sort();
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(i, ints[i]);
+  }
+  for (int i = 0; i < 100; ++i) {
+    ints.add(0, 1000 - i);
+  }
+  ints.radix_sort();
+  ASSERT_EQ(0, ints[0]);
+  ASSERT_EQ(1000, ints[109]);
+  while (ints.size() > 3) {
+    ints.remove(ints.size() - 1);
+  }
+  ints.shrink_to_fit();
+  ints.add(7);
+  ASSERT_EQ(4, ints.size());
+  ASSERT_EQ(7, ints[3]);
+  SmallArrayList<string,4> strs;
+  strs.add("b");
+  strs.add("a");
+  SmallArrayList<string,4> strs_copy = strs;
+  for (int i = 0; i < 20; ++i) {
+    strs.add(to_string(i));
+  }
+  strs_copy = strs;
+  ASSERT_EQ(22, strs_copy.size());
+  ASSERT_EQ("b", strs_copy[0]);
+  BinSearchCollection<int,int> c;
+  for (int i = 0; i < 100; ++i) {
+    c.add(i, i);
+  }
+  SmallArrayList<int> keys;
+  c.find(10, 19, keys);
+  ASSERT_EQ(10, keys.size());
+  c.find(20, 49, keys);
+  ASSERT_EQ(40, keys.size());
+  ASSERT_EQ(49, keys[39]);
+}
+
+//TEST 48: Tests segmented list adds, removes, indexing across segment
+//boundaries, sorting, copies, and that appends don't move items
+TEST(SegmentedListTest, AddRemoveAndStableAddresses) {
+  SegmentedList<int> list;
+  for (int i = 0; i < 1000; ++i) {
+    list.add(i);
+  }
+  int* first = &list[0];
+  int* boundary = &list[15];
+  for (int i = 1000; i < 100000; ++i) {
+    list.add(i);
+  }
+  ASSERT_EQ(first, &list[0]);
+  ASSERT_EQ(boundary, &list[15]);
+  for (size_t i = 0; i < list.size(); ++i) {
+    ASSERT_EQ(i, list[i]);
+  }
+  int val;
+  ASSERT_EQ(true, list.get(99999, val));
+  ASSERT_EQ(99999, val);
+  ASSERT_EQ(false, list.get(100000, val));
+  ASSERT_EQ(true, list.add(16, -1));
+  ASSERT_EQ(-1, list[16]);
+  ASSERT_EQ(16, list[17]);
+  ASSERT_EQ(true, list.remove(0));
+  ASSERT_EQ(false, list.remove(100000));
+  ASSERT_EQ(100000, list.size());
+  ASSERT_EQ(true, list.set(0, 500000));
+  list.sort();
+  ASSERT_EQ(-1, list[0]);
+  ASSERT_EQ(500000, list[99999]);
+  SegmentedList<string> strs;
+  for (int i = 0; i < 40; ++i) {
+    strs.add(0, to_string(i));
+  }
+  SegmentedList<string> copy = strs;
+  strs.remove(39);
+  ASSERT_EQ(39, strs.size());
+  ASSERT_EQ(40, copy.size());
+  ASSERT_EQ("39", copy[0]);
+  ASSERT_EQ("0", copy[39]);
+  copy.sort();
+  ASSERT_EQ("0", copy[0]);
+  ASSERT_EQ("9", copy[39]);
+}
+
+//TEST 49: Tests linked list iterators, removing through an iterator,
+//and indexed access in any order with the cached cursor
+TEST(LinkedListTest, IteratorsAndCursor) {
+  LinkedList<int> list;
+  ASSERT_EQ(true, list.begin() == list.end());
+  for (int i = 0; i < 100; ++i) {
+    list.add(i);
+  }
+  int val;
+  for (size_t i = 0; i < 100; ++i) {
+    ASSERT_EQ(true, list.get(i, val));
+    ASSERT_EQ(i, val);
+  }
+  //backwards, then jumping around
+  for (size_t i = 100; i > 0; --i) {
+    list.get(i - 1, val);
+    ASSERT_EQ(i - 1, val);
+  }
+  list.get(50, val);
+  list.set(10, -10);
+  list.get(10, val);
+  ASSERT_EQ(-10, val);
+  list.get(60, val);
+  list.remove(55);
+  list.get(55, val);
+  ASSERT_EQ(56, val);
+  list.add(55, 55);
+  list.add(0, -1);
+  list.get(56, val);
+  ASSERT_EQ(55, val);
+  list.remove(0);
+  list.set(10, 10);
+  //remove the odd items with the iterator
+  for (auto it = list.begin(); it != list.end(); ) {
+    if (*it % 2 == 1) {
+      it = list.remove(it);
+    } else {
+      ++it;
+    }
+  }
+  ASSERT_EQ(50, list.size());
+  int expected = 0;
+  const LinkedList<int>& same = list;
+  for (const int& item : same) {
+    ASSERT_EQ(expected, item);
+    expected += 2;
+  }
+  list.add(1000);
+  list.get(50, val);
+  ASSERT_EQ(1000, val);
+  list.add(0, 5);
+  list.sort();
+  list.get(3, val);
+  ASSERT_EQ(5, val);
+  list.get(51, val);
+  ASSERT_EQ(1000, val);
+  //removing the last node through an iterator moves the tail
+  auto last = list.begin();
+  for (int i = 0; i < 51; ++i) {
+    ++last;
+  }
+  ASSERT_EQ(true, list.remove(last) == list.end());
+  list.add(7);
+  list.get(51, val);
+  ASSERT_EQ(7, val);
+  LinkedListCollection<string,int> c;
+  c.add("b", 2);
+  c.add("a", 1);
+  c.add("c", 3);
+  c.remove("c");
+  c.remove("a");
+  ASSERT_EQ(1, c.size());
+  ASSERT_EQ(true, c.find("b", val));
+  ASSERT_EQ(2, val);
+  ASSERT_EQ(false, c.find("a", val));
+  c.add("d", 4);
+  ArrayList<string> keys;
+  c.find("a", "c", keys);
+  ASSERT_EQ(1, keys.size());
+  ASSERT_EQ("b", keys[0]);
+}
+
+//TEST 50: Tests an unrolled linked list against an ArrayList doing the
+//same inserts and removes (splitting and merging nodes), for ints and
+//for strings (fewer items per node)
+template<typename T>
+void check_unrolled(T (*make)(int)) {
+  UnrolledLinkedList<T> list;
+  ArrayList<T> expected;
+  unsigned long r = 2166136261ul;
+  for (int i = 0; i < 3000; ++i) {
+    r = r * 6364136223846793005ul + 1442695040888963407ul;
+    size_t op = (r >> 33) % 10;
+    if (op < 3) {
+      list.add(make(i));
+      expected.add(make(i));
+    } else if (op < 7) {
+      size_t index = (r >> 17) % (expected.size() + 1);
+      ASSERT_EQ(true, list.add(index, make(i)));
+      expected.add(index, make(i));
+    } else if (expected.size() > 0) {
+      size_t index = (r >> 17) % expected.size();
+      ASSERT_EQ(true, list.remove(index));
+      expected.remove(index);
+    }
+    ASSERT_EQ(expected.size(), list.size());
+  }
+  T val;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(true, list.get(i, val));
+    ASSERT_EQ(expected[i], val);
+  }
+  ASSERT_EQ(false, list.get(expected.size(), val));
+  size_t i = 0;
+  for (const T& item : list) {
+    ASSERT_EQ(expected[i++], item);
+  }
+  ASSERT_EQ(expected.size(), i);
+  UnrolledLinkedList<T> copy = list;
+  list.sort();
+  expected.sort();
+  i = 0;
+  for (const T& item : list) {
+    ASSERT_EQ(expected[i++], item);
+  }
+  ASSERT_EQ(expected.size(), copy.size());
+  while (list.size() > 0) {
+    list.remove(list.size() - 1);
+  }
+  ASSERT_EQ(true, list.begin() == list.end());
+  list.add(make(1));
+  ASSERT_EQ(true, list.set(0, make(2)));
+  list.get(0, val);
+  ASSERT_EQ(make(2), val);
+}
+
+int make_int(int i) {return i;}
+string make_string(int i) {return to_string(i);}
+
+TEST(UnrolledLinkedListTest, MatchesArrayList) {
+  check_unrolled<int>(make_int);
+  check_unrolled<string>(make_string);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
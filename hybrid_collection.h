@@ -0,0 +1,404 @@
+//----------------------------------------------------------------------
+// FILE: hybrid_collection.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a version of the collection class that keeps two
+//        indexes over the same nodes: a chained hash table for point
+//        lookups and an AVL tree for ordered operations. Each node is
+//        linked into both, so a find is O(1) on average while range
+//        queries and sort walk the tree in O(log n + k).
+//----------------------------------------------------------------------
+
+#ifndef HYBRID_COLLECTION_H
+#define HYBRID_COLLECTION_H
+
+#include "collection.h"
+#include "array_list.h"
+#include <functional>
+
+using namespace std;
+
+template<typename K, typename V>
+class HybridCollection : public Collection<K,V>
+{
+  public:
+    HybridCollection();
+    HybridCollection(const HybridCollection<K,V>& rhs);
+    ~HybridCollection();
+    HybridCollection& operator=(const HybridCollection<K,V>& rhs);
+
+    void add(const K& key, const V& val);
+    void remove(const K& key);
+    bool find(const K& key, V& val) const;
+    void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
+    void keys(ArrayList<K>& all_keys) const;
+    void sort(ArrayList<K>& all_keys_sorted) const;
+    size_t size() const;
+    size_t height() const;
+
+  private:
+    struct Node {
+      K key;
+      V value;
+      // hash chain link
+      Node* next;
+      // tree links
+      Node* left;
+      Node* right;
+      int height;
+    };
+    Node** hash_table;
+    size_t table_capacity;
+    Node* root;
+    size_t length;
+    double load_factor_threshold = 0.75;
+    // hash index helpers
+    void resize_and_rehash();
+    Node* unlink_from_table(const K& key);
+    // tree index helpers
+    Node* add(Node* subtree_root, Node* new_node);
+    Node* remove(Node* subtree_root, const K& key);
+    Node* remove_min(Node* subtree_root, Node*& min_node);
+    void find(const Node* subtree_root, const K& k1, const K& k2, ArrayList<K>& keys) const;
+    void keys(const Node* subtree_root, ArrayList<K>& all_keys) const;
+    void copy(const Node* rhs_subtree_root);
+    int node_height(const Node* subtree_root) const;
+    void update_height(Node* subtree_root);
+    Node* rotate_right(Node* k2);
+    Node* rotate_left(Node* k2);
+    Node* rebalance(Node* subtree_root);
+    void make_empty();
+};
+
+template<typename K, typename V>
+HybridCollection<K,V>::HybridCollection()
+  : table_capacity(16), root(nullptr), length(0)
+{
+  hash_table = new Node*[table_capacity];
+  //make each bucket null
+  for (size_t i = 0; i < table_capacity; ++i) {
+    hash_table[i] = nullptr;
+  }
+}
+
+template<typename K, typename V>
+HybridCollection<K,V>::HybridCollection(const HybridCollection<K,V>& rhs)
+  : hash_table(nullptr), table_capacity(0), root(nullptr), length(0)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+template<typename K, typename V>
+HybridCollection<K,V>::~HybridCollection() {
+  make_empty();
+}
+
+template<typename K, typename V>
+HybridCollection<K,V>& HybridCollection<K,V>::operator=(const HybridCollection<K,V>& rhs) {
+  if (this != &rhs) {
+    make_empty();
+    table_capacity = 16;
+    hash_table = new Node*[table_capacity];
+    for (size_t i = 0; i < table_capacity; ++i) {
+      hash_table[i] = nullptr;
+    }
+    copy(rhs.root);
+  }
+  return *this;
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::add(const K& k, const V& val) {
+  // check to see if table needs to be resized
+  if (length * 1.0 / table_capacity >= load_factor_threshold) {
+    resize_and_rehash();
+  }
+  Node* new_node = new Node;
+  new_node->key = k;
+  new_node->value = val;
+  new_node->left = nullptr;
+  new_node->right = nullptr;
+  new_node->height = 1;
+  // link into hash index
+  std::hash<K> hash_fun;
+  size_t index = hash_fun(k) % table_capacity;
+  new_node->next = hash_table[index];
+  hash_table[index] = new_node;
+  // link into tree index
+  root = add(root, new_node);
+  length = length + 1;
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::remove(const K& k) {
+  // the hash index tells us cheaply whether the key is present
+  Node* node = unlink_from_table(k);
+  if (node == nullptr) {
+    return;
+  }
+  root = remove(root, k);
+  delete node;
+  length = length - 1;
+}
+
+template<typename K, typename V>
+bool HybridCollection<K,V>::find(const K& k, V& v) const {
+  // point lookups only use the hash index
+  std::hash<K> hash_fun;
+  size_t index = hash_fun(k) % table_capacity;
+  Node* curr = hash_table[index];
+  while (curr != nullptr && curr->key != k) {
+    curr = curr->next;
+  }
+  if (curr != nullptr) {
+    v = curr->value;
+    return true;
+  }
+  return false;
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  //range queries only use the tree index
+  find(root, k1, k2, keys);
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::keys(ArrayList<K>& all_keys) const {
+  keys(root, all_keys);
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+  //in-order walk is already sorted
+  keys(root, all_keys_sorted);
+}
+
+template<typename K, typename V>
+size_t HybridCollection<K,V>::size() const {
+  return length;
+}
+
+template<typename K, typename V>
+size_t HybridCollection<K,V>::height() const {
+  return node_height(root);
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::resize_and_rehash() {
+  size_t new_capacity = 2 * table_capacity;
+  Node** copy = new Node*[new_capacity];
+  for (size_t i = 0; i < new_capacity; ++i) {
+    copy[i] = nullptr;
+  }
+  std::hash<K> hash_fun;
+  //relink each node's chain pointer, the tree is untouched
+  for (size_t i = 0; i < table_capacity; ++i) {
+    Node* curr = hash_table[i];
+    while (curr != nullptr) {
+      size_t index = hash_fun(curr->key) % new_capacity;
+      Node* temp = curr->next;
+      curr->next = copy[index];
+      copy[index] = curr;
+      curr = temp;
+    }
+  }
+  delete [] hash_table;
+  hash_table = copy;
+  table_capacity = new_capacity;
+}
+
+template<typename K, typename V>
+typename HybridCollection<K,V>::Node*
+HybridCollection<K,V>::unlink_from_table(const K& k) {
+  std::hash<K> hash_fun;
+  size_t index = hash_fun(k) % table_capacity;
+  Node* curr = hash_table[index];
+  Node* prev = nullptr;
+  while (curr != nullptr && curr->key != k) {
+    prev = curr;
+    curr = curr->next;
+  }
+  if (curr != nullptr) {
+    if (prev != nullptr) {
+      prev->next = curr->next;
+    } else {
+      hash_table[index] = curr->next;
+    }
+  }
+  return curr;
+}
+
+template<typename K, typename V>
+typename HybridCollection<K,V>::Node*
+HybridCollection<K,V>::add(Node* subtree_root, Node* new_node) {
+  //add node as leaf
+  if (subtree_root == nullptr) {
+    return new_node;
+  }
+  if (new_node->key < subtree_root->key) {
+    subtree_root->left = add(subtree_root->left, new_node);
+  } else {
+    subtree_root->right = add(subtree_root->right, new_node);
+  }
+  return rebalance(subtree_root);
+}
+
+template<typename K, typename V>
+typename HybridCollection<K,V>::Node*
+HybridCollection<K,V>::remove(Node* subtree_root, const K& k) {
+  if (subtree_root == nullptr) {
+    return subtree_root;
+  }
+  if (k < subtree_root->key) {
+    subtree_root->left = remove(subtree_root->left, k);
+  } else if (subtree_root->key < k) {
+    subtree_root->right = remove(subtree_root->right, k);
+  } else {
+    //nodes are shared with the hash index, so the successor node is
+    //moved into place instead of copying its key-value pair
+    if (subtree_root->left == nullptr) {
+      return subtree_root->right;
+    } else if (subtree_root->right == nullptr) {
+      return subtree_root->left;
+    }
+    Node* successor = nullptr;
+    Node* right = remove_min(subtree_root->right, successor);
+    successor->left = subtree_root->left;
+    successor->right = right;
+    subtree_root = successor;
+  }
+  return rebalance(subtree_root);
+}
+
+template<typename K, typename V>
+typename HybridCollection<K,V>::Node*
+HybridCollection<K,V>::remove_min(Node* subtree_root, Node*& min_node) {
+  if (subtree_root->left == nullptr) {
+    min_node = subtree_root;
+    return subtree_root->right;
+  }
+  subtree_root->left = remove_min(subtree_root->left, min_node);
+  return rebalance(subtree_root);
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::find(const Node* subtree_root, const K& k1, const K& k2,
+ArrayList<K>& keys) const {
+  if (subtree_root == nullptr) {
+    return;
+  }
+  //only visit subtrees that can overlap the range, in order
+  if (k1 < subtree_root->key) {
+    find(subtree_root->left, k1, k2, keys);
+  }
+  if (subtree_root->key >= k1 && subtree_root->key <= k2) {
+    keys.add(subtree_root->key);
+  }
+  if (subtree_root->key < k2) {
+    find(subtree_root->right, k1, k2, keys);
+  }
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::keys(const Node* subtree_root, ArrayList<K>& all_keys) const {
+  if (subtree_root == nullptr) {
+    return;
+  }
+  keys(subtree_root->left, all_keys);
+  all_keys.add(subtree_root->key);
+  keys(subtree_root->right, all_keys);
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::copy(const Node* rhs_subtree_root) {
+  if (rhs_subtree_root == nullptr) {
+    return;
+  }
+  add(rhs_subtree_root->key, rhs_subtree_root->value);
+  copy(rhs_subtree_root->left);
+  copy(rhs_subtree_root->right);
+}
+
+template<typename K, typename V>
+int HybridCollection<K,V>::node_height(const Node* subtree_root) const {
+  return subtree_root == nullptr ? 0 : subtree_root->height;
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::update_height(Node* subtree_root) {
+  int l_height = node_height(subtree_root->left);
+  int r_height = node_height(subtree_root->right);
+  subtree_root->height = 1 + (l_height > r_height ? l_height : r_height);
+}
+
+template<typename K, typename V>
+typename HybridCollection<K,V>::Node*
+HybridCollection<K,V>::rotate_right(Node* k2) {
+  Node* k1 = k2->left;
+  k2->left = k1->right;
+  k1->right = k2;
+  update_height(k2);
+  update_height(k1);
+  return k1;
+}
+
+template<typename K, typename V>
+typename HybridCollection<K,V>::Node*
+HybridCollection<K,V>::rotate_left(Node* k2) {
+  Node* k1 = k2->right;
+  k2->right = k1->left;
+  k1->left = k2;
+  update_height(k2);
+  update_height(k1);
+  return k1;
+}
+
+template<typename K, typename V>
+typename HybridCollection<K,V>::Node*
+HybridCollection<K,V>::rebalance(Node* subtree_root) {
+  update_height(subtree_root);
+  int balance = node_height(subtree_root->left) - node_height(subtree_root->right);
+  //left heavy
+  if (balance > 1) {
+    Node* lptr = subtree_root->left;
+    //left-right case needs a double rotation
+    if (node_height(lptr->right) > node_height(lptr->left)) {
+      subtree_root->left = rotate_left(lptr);
+    }
+    return rotate_right(subtree_root);
+  }
+  //right heavy
+  if (balance < -1) {
+    Node* rptr = subtree_root->right;
+    //right-left case needs a double rotation
+    if (node_height(rptr->left) > node_height(rptr->right)) {
+      subtree_root->right = rotate_right(rptr);
+    }
+    return rotate_left(subtree_root);
+  }
+  return subtree_root;
+}
+
+template<typename K, typename V>
+void HybridCollection<K,V>::make_empty() {
+  if (hash_table != nullptr) {
+    //every node is in exactly one chain, so free them from there
+    for (size_t i = 0; i < table_capacity; ++i) {
+      Node* curr = hash_table[i];
+      while (curr != nullptr) {
+        Node* next_node = curr->next;
+        delete curr;
+        curr = next_node;
+      }
+    }
+    delete [] hash_table;
+    hash_table = nullptr;
+  }
+  root = nullptr;
+  length = 0;
+  table_capacity = 0;
+}
+
+#endif
@@ -0,0 +1,242 @@
+//----------------------------------------------------------------------
+// FILE: linked_hash_collection.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a version of the hash table collection in which the
+//        nodes are also threaded into a doubly linked list in insertion
+//        order. Walking that list makes keys (and range finds) O(size)
+//        instead of O(capacity), which matters for sparse tables after
+//        many removes, and gives a stable iteration order.
+//----------------------------------------------------------------------
+
+#ifndef LINKED_HASH_COLLECTION_H
+#define LINKED_HASH_COLLECTION_H
+
+#include "collection.h"
+#include "array_list.h"
+#include <functional>
+
+using namespace std;
+
+template<typename K, typename V>
+class LinkedHashCollection : public Collection<K,V>
+{
+  public:
+    LinkedHashCollection();
+    LinkedHashCollection(const LinkedHashCollection<K,V>& rhs);
+    ~LinkedHashCollection();
+    LinkedHashCollection& operator=(const LinkedHashCollection<K,V>& rhs);
+
+    void add(const K& key, const V& val);
+    void remove(const K& key);
+    bool find(const K& key, V& val) const;
+    void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
+    // keys are returned in the order they were added
+    void keys(ArrayList<K>& all_keys) const;
+    void sort(ArrayList<K>& all_keys_sorted) const;
+    size_t size() const;
+
+  private:
+    struct Node {
+      K key;
+      V value;
+      // hash chain link
+      Node* next;
+      // insertion order links
+      Node* before;
+      Node* after;
+    };
+    Node** hash_table;
+    size_t length;
+    size_t table_capacity;
+    // oldest and newest nodes
+    Node* head;
+    Node* tail;
+    double load_factor_threshold = 0.75;
+    void resize_and_rehash();
+    void make_empty();
+};
+
+template<typename K, typename V>
+LinkedHashCollection<K,V>::LinkedHashCollection()
+  : length(0), table_capacity(16), head(nullptr), tail(nullptr)
+{
+  hash_table = new Node*[table_capacity];
+  //make each bucket null
+  for (size_t i = 0; i < table_capacity; ++i) {
+    hash_table[i] = nullptr;
+  }
+}
+
+template<typename K, typename V>
+LinkedHashCollection<K,V>::LinkedHashCollection(const LinkedHashCollection<K,V>& rhs)
+  : hash_table(nullptr), length(0), table_capacity(0), head(nullptr), tail(nullptr)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+template<typename K, typename V>
+LinkedHashCollection<K,V>::~LinkedHashCollection() {
+  make_empty();
+}
+
+template<typename K, typename V>
+LinkedHashCollection<K,V>& LinkedHashCollection<K,V>::operator=
+(const LinkedHashCollection<K,V>& rhs) {
+  if (this != &rhs) {
+    make_empty();
+    table_capacity = 16;
+    hash_table = new Node*[table_capacity];
+    for (size_t i = 0; i < table_capacity; ++i) {
+      hash_table[i] = nullptr;
+    }
+    //add in rhs insertion order so the copy iterates the same way
+    for (Node* curr = rhs.head; curr != nullptr; curr = curr->after) {
+      add(curr->key, curr->value);
+    }
+  }
+  return *this;
+}
+
+template<typename K, typename V>
+void LinkedHashCollection<K,V>::add(const K& k, const V& val) {
+  // check to see if table needs to be resized
+  if (length * 1.0 / table_capacity >= load_factor_threshold) {
+    resize_and_rehash();
+  }
+  std::hash<K> hash_fun;
+  size_t index = hash_fun(k) % table_capacity;
+  Node* new_node = new Node;
+  new_node->key = k;
+  new_node->value = val;
+  new_node->next = hash_table[index];
+  hash_table[index] = new_node;
+  //append to the end of the insertion order
+  new_node->before = tail;
+  new_node->after = nullptr;
+  if (tail != nullptr) {
+    tail->after = new_node;
+  } else {
+    head = new_node;
+  }
+  tail = new_node;
+  length = length + 1;
+}
+
+template<typename K, typename V>
+void LinkedHashCollection<K,V>::remove(const K& k) {
+  std::hash<K> hash_fun;
+  size_t index = hash_fun(k) % table_capacity;
+  // find key within linked list in hashed bucket
+  Node* curr = hash_table[index];
+  Node* prev = nullptr;
+  while (curr != nullptr && curr->key != k) {
+    prev = curr;
+    curr = curr->next;
+  }
+  if (curr == nullptr) {
+    return;
+  }
+  //unlink from the chain
+  if (prev != nullptr) {
+    prev->next = curr->next;
+  } else {
+    hash_table[index] = curr->next;
+  }
+  //unlink from the insertion order
+  if (curr->before != nullptr) {
+    curr->before->after = curr->after;
+  } else {
+    head = curr->after;
+  }
+  if (curr->after != nullptr) {
+    curr->after->before = curr->before;
+  } else {
+    tail = curr->before;
+  }
+  delete curr;
+  length = length - 1;
+}
+
+template<typename K, typename V>
+bool LinkedHashCollection<K,V>::find(const K& k, V& v) const {
+  std::hash<K> hash_fun;
+  size_t index = hash_fun(k) % table_capacity;
+  Node* curr = hash_table[index];
+  while (curr != nullptr && curr->key != k) {
+    curr = curr->next;
+  }
+  if (curr != nullptr) {
+    v = curr->value;
+    return true;
+  }
+  return false;
+}
+
+template<typename K, typename V>
+void LinkedHashCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  //only the live nodes are visited, not the empty buckets
+  for (Node* curr = head; curr != nullptr; curr = curr->after) {
+    if (curr->key >= k1 && curr->key <= k2) {
+      keys.add(curr->key);
+    }
+  }
+}
+
+template<typename K, typename V>
+void LinkedHashCollection<K,V>::keys(ArrayList<K>& all_keys) const {
+  for (Node* curr = head; curr != nullptr; curr = curr->after) {
+    all_keys.add(curr->key);
+  }
+}
+
+template<typename K, typename V>
+void LinkedHashCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+  //get all keys
+  keys(all_keys_sorted);
+  //sort resulting array
+  all_keys_sorted.sort();
+}
+
+template<typename K, typename V>
+size_t LinkedHashCollection<K,V>::size() const {
+  return length;
+}
+
+template<typename K, typename V>
+void LinkedHashCollection<K,V>::resize_and_rehash() {
+  size_t new_capacity = 2 * table_capacity;
+  Node** copy = new Node*[new_capacity];
+  for (size_t i = 0; i < new_capacity; ++i) {
+    copy[i] = nullptr;
+  }
+  std::hash<K> hash_fun;
+  //walk the insertion order instead of the buckets
+  for (Node* curr = head; curr != nullptr; curr = curr->after) {
+    size_t index = hash_fun(curr->key) % new_capacity;
+    curr->next = copy[index];
+    copy[index] = curr;
+  }
+  delete [] hash_table;
+  hash_table = copy;
+  table_capacity = new_capacity;
+}
+
+template<typename K, typename V>
+void LinkedHashCollection<K,V>::make_empty() {
+  Node* curr = head;
+  while (curr != nullptr) {
+    Node* next_node = curr->after;
+    delete curr;
+    curr = next_node;
+  }
+  delete [] hash_table;
+  hash_table = nullptr;
+  head = nullptr;
+  tail = nullptr;
+  length = 0;
+  table_capacity = 0;
+}
+
+#endif
@@ -5,7 +5,9 @@
 // DESC: Implements a linked list version of the list class. Elements
 //       are added by default to the end of the list via a tail pointer.
 //		 Implementations for selection, insertion, merge, and quick sort
-//       are included.
+//       are included. The node found by the last indexed access is
+//       cached, so walking the list by increasing index is O(1) per
+//       step, and iterators give single-pass scans and removes.
 //----------------------------------------------------------------------
 
 
@@ -20,7 +22,29 @@ using namespace std;
 template<typename T>
 class LinkedList : public List<T>
 {
+  struct Node;
+
 public:
+  // forward iterator over the items (Item is T or const T); it also
+  // tracks the node before it, so the item it is on can be removed
+  template<typename Item>
+  class Iterator
+  {
+  public:
+    Item& operator*() const {return curr->value;}
+    Item* operator->() const {return &curr->value;}
+    Iterator& operator++() {prev = curr; curr = curr->next; return *this;}
+    bool operator==(const Iterator& rhs) const {return curr == rhs.curr;}
+    bool operator!=(const Iterator& rhs) const {return curr != rhs.curr;}
+  private:
+    friend class LinkedList<T>;
+    Iterator(Node* prev, Node* curr) : prev(prev), curr(curr) {}
+    Node* prev;
+    Node* curr;
+  };
+  typedef Iterator<T> iterator;
+  typedef Iterator<const T> const_iterator;
+
   LinkedList();
   LinkedList(const LinkedList<T>& rhs);
   ~LinkedList();
@@ -31,7 +55,13 @@ public:
   bool get(size_t index, T& return_item) const;
   bool set(size_t index, const T& new_item);
   bool remove(size_t index);
+  // removes the item pos is on, returning an iterator to the next item
+  iterator remove(iterator pos);
   size_t size() const;
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
   void selection_sort();
   void insertion_sort();
   void merge_sort();
@@ -46,9 +76,16 @@ private:
   Node* head;
   Node* tail;
   size_t length;
+  // last node reached by index (null if none), so the next access can
+  // start there instead of at head when its index is not lower; this
+  // makes const gets unsafe to share between threads
+  mutable Node* cursor_node;
+  mutable size_t cursor_index;
 
   //helper functions
   void make_empty();
+  // node at index (< length), walking from the cursor when possible
+  Node* node_at(size_t index) const;
   Node* merge_sort(Node* left, int len);
   Node* quick_sort(Node* start, int len);
 };
@@ -56,14 +93,16 @@ private:
 
 template<typename T>
 LinkedList<T>::LinkedList()
-  : head(nullptr), tail(nullptr), length(0)
+  : head(nullptr), tail(nullptr), length(0), cursor_node(nullptr),
+    cursor_index(0)
 {
 }
 
 
 template<typename T>
 LinkedList<T>::LinkedList(const LinkedList<T>& rhs)
-  : head(nullptr), tail(nullptr), length(0)
+  : head(nullptr), tail(nullptr), length(0), cursor_node(nullptr),
+    cursor_index(0)
 {
   // defer to assignment operator
   *this = rhs;
@@ -136,12 +175,12 @@ bool LinkedList<T>::add(size_t index, const T& item){
   	if (tail == nullptr) {
   		tail = head;
   	}
+  	//items after the front shift, so the cursor is stale
+  	cursor_node = nullptr;
   } else {
-  	//get to right element if not
-  	for (int i = 1; i <= index; i++) {
-  		prev_node = curr_node;
-  		curr_node = curr_node->next;
-  	}
+  	//get to right element if not (the cursor stays on prev_node)
+  	prev_node = node_at(index - 1);
+  	curr_node = prev_node->next;
   	//update pointers to add new node into list
   	prev_node->next = new_node;
   	new_node->next = curr_node;
@@ -159,12 +198,8 @@ bool LinkedList<T>::get(size_t index, T& return_item) const{
   if (index >= length) {
   	return false;
   }
-  Node * curr_node = head;
   //get to right index in list
-  for (int i = 1; i <= index; i++) {
-  	curr_node = curr_node->next;
-  }
-  return_item = curr_node->value;
+  return_item = node_at(index)->value;
   return true;
 }
   
@@ -174,13 +209,8 @@ bool LinkedList<T>::set(size_t index, const T& new_item){
   if (index >= length) {
   	return false;
   }
-  Node * curr_node = head;
-  //get to right index in list
-  for (int i = 1; i <= index; i++) {
-  	curr_node = curr_node->next;
-  } 
   //update node to new value
-  curr_node->value = new_item; 
+  node_at(index)->value = new_item;
   return true;
 }
   
@@ -199,12 +229,11 @@ bool LinkedList<T>::remove(size_t index){
   		tail = nullptr;
   	}
   	delete curr_node;
+  	cursor_node = nullptr;
   } else {
-  	//find element to delete
-  	for (int i = 1; i <= index; i++) {
-  		prev_node = curr_node;
-		curr_node = curr_node->next;
-  	}
+  	//find element to delete (the cursor stays on prev_node)
+  	prev_node = node_at(index - 1);
+  	curr_node = prev_node->next;
   	prev_node->next = curr_node->next;
   	//check to see if node being deleted is tail
   	if (curr_node == tail) {
@@ -218,11 +247,71 @@ bool LinkedList<T>::remove(size_t index){
   return true;
 }
 
+template<typename T>
+typename LinkedList<T>::iterator LinkedList<T>::remove(iterator pos){
+  Node * curr_node = pos.curr;
+  Node * next_node = curr_node->next;
+  //unlink, updating head and tail if needed
+  if (pos.prev == nullptr) {
+  	head = next_node;
+  } else {
+  	pos.prev->next = next_node;
+  }
+  if (curr_node == tail) {
+  	tail = pos.prev;
+  }
+  delete curr_node;
+  length--;
+  cursor_node = nullptr;
+  return iterator(pos.prev, next_node);
+}
+
 template<typename T>  
 size_t LinkedList<T>::size() const {
   return this->length;
 }
 
+template<typename T>
+typename LinkedList<T>::iterator LinkedList<T>::begin(){
+  return iterator(nullptr, head);
+}
+
+template<typename T>
+typename LinkedList<T>::iterator LinkedList<T>::end(){
+  return iterator(tail, nullptr);
+}
+
+template<typename T>
+typename LinkedList<T>::const_iterator LinkedList<T>::begin() const{
+  return const_iterator(nullptr, head);
+}
+
+template<typename T>
+typename LinkedList<T>::const_iterator LinkedList<T>::end() const{
+  return const_iterator(tail, nullptr);
+}
+
+template<typename T>
+typename LinkedList<T>::Node* LinkedList<T>::node_at(size_t index) const{
+  Node * curr_node = head;
+  size_t i = 0;
+  //appends never move nodes, so the tail is always a shortcut
+  if (index == length - 1) {
+  	curr_node = tail;
+  	i = index;
+  } else if (cursor_node != nullptr && cursor_index <= index) {
+  	curr_node = cursor_node;
+  	i = cursor_index;
+  }
+  while (i < index) {
+  	curr_node = curr_node->next;
+  	i++;
+  }
+  cursor_node = curr_node;
+  cursor_index = index;
+  return curr_node;
+}
+
 template<typename T>
 void LinkedList<T>::make_empty(){
 	Node * curr_node = head;
@@ -236,10 +325,13 @@ void LinkedList<T>::make_empty(){
 	length = 0;
 	head = nullptr;
 	tail = nullptr;
+	cursor_node = nullptr;
 }
 
 template<typename T>
 void LinkedList<T>::selection_sort(){
+	//sorting relinks nodes, so the cursor's index is stale
+	cursor_node = nullptr;
 	Node * smallest = head;
 	Node * curr_node = head;
 	Node * prev_node = nullptr;
@@ -281,6 +373,8 @@ void LinkedList<T>::selection_sort(){
 
 template<typename T>
 void LinkedList<T>::insertion_sort(){
+	//sorting relinks nodes, so the cursor's index is stale
+	cursor_node = nullptr;
 	//returns if 0 or 1 items are in the list
 	if (length <= 1) {
 		return;
@@ -327,6 +421,8 @@ void LinkedList<T>::insertion_sort(){
 
 template<typename T>
 void LinkedList<T>::merge_sort() {
+	//sorting relinks nodes, so the cursor's index is stale
+	cursor_node = nullptr;
 	//check to see if list is already sorted (1 elem)
 	if (length > 1) {
 		head = merge_sort(head, length);
@@ -399,6 +495,8 @@ LinkedList<T>::merge_sort(Node* left, int len) {
 
 template<typename T>
 void LinkedList<T>::quick_sort() {
+	//sorting relinks nodes, so the cursor's index is stale
+	cursor_node = nullptr;
 	//check to see if list is already sorted (1 elem)
 	if (length > 1) {
 		head = quick_sort(head, length);
@@ -22,6 +22,8 @@ class LinkedListCollection : public Collection<K,V>
 		bool find(const K& key, V& val) const;
 		void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
 		void keys(ArrayList<K>& all_keys) const;
+		// every pair in one scan of the list
+		void pairs(ArrayList<std::pair<K,V>>& all_pairs) const;
 		void sort(ArrayList<K>& all_keys_sorted) const;
 		size_t size() const;
 		
@@ -36,12 +38,10 @@ void LinkedListCollection<K,V>::add(const K& key, const V& val) {
 
 template<typename K, typename V>
 void LinkedListCollection<K,V>::remove(const K& key) {
-	std::pair<K,V> curr;
-	//search through list to find key to remove
-	for (int i = 0; i < kv_list.size(); ++i) {
-		kv_list.get(i, curr);
-		if (curr.first == key) {
-			kv_list.remove(i);
+	//search through list to find key to remove, in one pass
+	for (auto it = kv_list.begin(); it != kv_list.end(); ++it) {
+		if (it->first == key) {
+			kv_list.remove(it);
 			//return early if found
 			return;
 		}
@@ -50,27 +50,21 @@ void LinkedListCollection<K,V>::remove(const K& key) {
 
 template<typename K, typename V>
 bool LinkedListCollection<K,V>::find(const K& key, V& val) const {
-	bool found = false;
-	std::pair<K,V> curr;
 	//search through list for desired key
-	for (int i = 0; i < kv_list.size(); ++i) {
-		kv_list.get(i, curr);
+	for (const std::pair<K,V>& curr : kv_list) {
 		if (curr.first == key) {
-			found = true;
 			//get key's matching value
 			val = curr.second;
-			return found;
+			return true;
 		}
 	}
-	return found;
+	return false;
 }
 
 template<typename K, typename V>
 void LinkedListCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
-	std::pair<K,V> curr;
 	//search through list for keys within range
-	for (int i = 0; i < kv_list.size(); ++i) {
-		kv_list.get(i, curr);
+	for (const std::pair<K,V>& curr : kv_list) {
 		if (curr.first >= k1 && curr.first <= k2) {
 			//add keys within range to array
 			keys.add(curr.first);
@@ -80,14 +74,22 @@ void LinkedListCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& key
 
 template<typename K, typename V>
 void LinkedListCollection<K,V>::keys(ArrayList<K>& all_keys) const {
-	std::pair<K,V> curr;
 	//add every key in list to array
-	for (size_t i = 0; i < kv_list.size(); ++i) {
-		kv_list.get(i, curr);
+	all_keys.reserve(all_keys.size() + kv_list.size());
+	for (const std::pair<K,V>& curr : kv_list) {
 		all_keys.add(curr.first);
 	}
 }
 
+template<typename K, typename V>
+void LinkedListCollection<K,V>::pairs(ArrayList<std::pair<K,V>>& all_pairs) const {
+	//the list already holds the pairs
+	all_pairs.reserve(all_pairs.size() + kv_list.size());
+	for (const std::pair<K,V>& curr : kv_list) {
+		all_pairs.add(curr);
+	}
+}
+
 template<typename K, typename V>
 void LinkedListCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
 	//get all keys
@@ -0,0 +1,339 @@
+//----------------------------------------------------------------------
+// FILE: perfect_hash_collection.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a read-only version of the collection class using a
+//        minimal perfect hash (CHD: compress, hash and displace). It is
+//        built once from another collection via freeze(). Keys are
+//        hashed into small buckets, and each bucket stores the one
+//        displacement that sends all of its keys to distinct slots, so
+//        n keys fill exactly n slots. A find computes the slot from the
+//        bucket's displacement and compares a single key. There are no
+//        chains and no empty slots. Adds and removes are ignored.
+//        Building throws invalid_argument if no displacement separates
+//        a bucket's keys, as happens when two keys have the same hash
+//        code (e.g., the source holds a key twice).
+//----------------------------------------------------------------------
+
+#ifndef PERFECT_HASH_COLLECTION_H
+#define PERFECT_HASH_COLLECTION_H
+
+#include "collection.h"
+#include "array_list.h"
+#include <functional>
+#include <stdexcept>
+
+using namespace std;
+
+template<typename K, typename V>
+class PerfectHashCollection : public Collection<K,V>
+{
+  public:
+    // build the perfect hash over every key-value pair in source
+    // (throws invalid_argument if some keys can't be separated)
+    PerfectHashCollection(const Collection<K,V>& source);
+    PerfectHashCollection(const PerfectHashCollection<K,V>& rhs);
+    ~PerfectHashCollection();
+    PerfectHashCollection& operator=(const PerfectHashCollection<K,V>& rhs);
+
+    // read-only: adds and removes leave the collection unchanged
+    void add(const K& key, const V& val);
+    void remove(const K& key);
+    bool find(const K& key, V& val) const;
+    void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
+    void keys(ArrayList<K>& all_keys) const;
+    void sort(ArrayList<K>& all_keys_sorted) const;
+    size_t size() const;
+
+  private:
+    // average keys per bucket (higher is smaller but slower to build)
+    static const size_t KEYS_PER_BUCKET = 4;
+    // displacements with this bit set name a slot directly (used for
+    // single-key buckets, which are placed last into leftover slots)
+    static const unsigned int DIRECT = 0x80000000u;
+    K* slot_keys;
+    V* slot_values;
+    unsigned int* displacements;
+    size_t bucket_count;
+    size_t length;
+    // well-mixed hash code for a key
+    unsigned long long hash_code(const K& key) const;
+    // slot for a hash code under a displacement
+    size_t slot(unsigned long long code, unsigned int d) const;
+    void build(const Collection<K,V>& source);
+    void make_empty();
+};
+
+// build a read-only perfect hash collection from any collection
+template<typename K, typename V>
+PerfectHashCollection<K,V> freeze(const Collection<K,V>& source)
+{
+  return PerfectHashCollection<K,V>(source);
+}
+
+template<typename K, typename V>
+PerfectHashCollection<K,V>::PerfectHashCollection(const Collection<K,V>& source)
+  : slot_keys(nullptr), slot_values(nullptr), displacements(nullptr),
+    bucket_count(0), length(0)
+{
+  build(source);
+}
+
+template<typename K, typename V>
+PerfectHashCollection<K,V>::PerfectHashCollection(const PerfectHashCollection<K,V>& rhs)
+  : slot_keys(nullptr), slot_values(nullptr), displacements(nullptr),
+    bucket_count(0), length(0)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+template<typename K, typename V>
+PerfectHashCollection<K,V>::~PerfectHashCollection() {
+  make_empty();
+}
+
+template<typename K, typename V>
+PerfectHashCollection<K,V>& PerfectHashCollection<K,V>::operator=
+(const PerfectHashCollection<K,V>& rhs) {
+  if (this != &rhs) {
+    make_empty();
+    length = rhs.length;
+    bucket_count = rhs.bucket_count;
+    slot_keys = new K[length];
+    slot_values = new V[length];
+    displacements = new unsigned int[bucket_count];
+    //the hash function is fixed, so the layout can be copied as-is
+    for (size_t i = 0; i < length; ++i) {
+      slot_keys[i] = rhs.slot_keys[i];
+      slot_values[i] = rhs.slot_values[i];
+    }
+    for (size_t i = 0; i < bucket_count; ++i) {
+      displacements[i] = rhs.displacements[i];
+    }
+  }
+  return *this;
+}
+
+template<typename K, typename V>
+void PerfectHashCollection<K,V>::add(const K& /*key*/, const V& /*val*/) {
+  // collection is frozen
+}
+
+template<typename K, typename V>
+void PerfectHashCollection<K,V>::remove(const K& /*key*/) {
+  // collection is frozen
+}
+
+template<typename K, typename V>
+bool PerfectHashCollection<K,V>::find(const K& k, V& v) const {
+  if (length == 0) {
+    return false;
+  }
+  unsigned long long code = hash_code(k);
+  unsigned int d = displacements[code % bucket_count];
+  size_t index = (d & DIRECT) ? (d & ~DIRECT) : slot(code, d);
+  //exactly one key to compare
+  if (slot_keys[index] == k) {
+    v = slot_values[index];
+    return true;
+  }
+  return false;
+}
+
+template<typename K, typename V>
+void PerfectHashCollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  for (size_t i = 0; i < length; ++i) {
+    if (slot_keys[i] >= k1 && slot_keys[i] <= k2) {
+      keys.add(slot_keys[i]);
+    }
+  }
+}
+
+template<typename K, typename V>
+void PerfectHashCollection<K,V>::keys(ArrayList<K>& all_keys) const {
+  //every slot holds a key
+  for (size_t i = 0; i < length; ++i) {
+    all_keys.add(slot_keys[i]);
+  }
+}
+
+template<typename K, typename V>
+void PerfectHashCollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+  //get all keys
+  keys(all_keys_sorted);
+  //sort resulting array
+  all_keys_sorted.sort();
+}
+
+template<typename K, typename V>
+size_t PerfectHashCollection<K,V>::size() const {
+  return length;
+}
+
+template<typename K, typename V>
+unsigned long long PerfectHashCollection<K,V>::hash_code(const K& key) const {
+  std::hash<K> hash_fun;
+  unsigned long long code = hash_fun(key);
+  code ^= code >> 33;
+  code *= 0xff51afd7ed558ccdull;
+  code ^= code >> 33;
+  code *= 0xc4ceb9fe1a85ec53ull;
+  code ^= code >> 33;
+  return code;
+}
+
+template<typename K, typename V>
+size_t PerfectHashCollection<K,V>::slot(unsigned long long code, unsigned int d) const {
+  //remix the code with the displacement to get an independent slot
+  code += (d + 1) * 0x9e3779b97f4a7c15ull;
+  code ^= code >> 31;
+  code *= 0xbf58476d1ce4e5b9ull;
+  code ^= code >> 29;
+  return code % length;
+}
+
+template<typename K, typename V>
+void PerfectHashCollection<K,V>::build(const Collection<K,V>& source) {
+  //every pair in one pass, rather than a find per key
+  ArrayList<std::pair<K,V>> all_pairs;
+  source.pairs(all_pairs);
+  length = all_pairs.size();
+  bucket_count = length / KEYS_PER_BUCKET + 1;
+  slot_keys = new K[length];
+  slot_values = new V[length];
+  displacements = new unsigned int[bucket_count];
+  if (length == 0) {
+    return;
+  }
+  // hash every key once and group the keys by bucket (counting sort)
+  unsigned long long* codes = new unsigned long long[length];
+  size_t* bucket_start = new size_t[bucket_count + 1];
+  size_t* order = new size_t[length];
+  for (size_t b = 0; b <= bucket_count; ++b) {
+    bucket_start[b] = 0;
+  }
+  for (size_t i = 0; i < length; ++i) {
+    codes[i] = hash_code(all_pairs[i].first);
+    bucket_start[codes[i] % bucket_count + 1]++;
+  }
+  size_t max_bucket = 0;
+  for (size_t b = 0; b < bucket_count; ++b) {
+    if (bucket_start[b + 1] > max_bucket) {
+      max_bucket = bucket_start[b + 1];
+    }
+    bucket_start[b + 1] += bucket_start[b];
+  }
+  size_t* fill = new size_t[bucket_count];
+  for (size_t b = 0; b < bucket_count; ++b) {
+    fill[b] = bucket_start[b];
+  }
+  for (size_t i = 0; i < length; ++i) {
+    order[fill[codes[i] % bucket_count]++] = i;
+  }
+  // visit buckets largest first (counting sort on bucket size)
+  size_t* by_size = new size_t[bucket_count];
+  size_t* size_start = new size_t[max_bucket + 2];
+  for (size_t s = 0; s <= max_bucket + 1; ++s) {
+    size_start[s] = 0;
+  }
+  for (size_t b = 0; b < bucket_count; ++b) {
+    size_start[max_bucket - (bucket_start[b + 1] - bucket_start[b]) + 1]++;
+  }
+  for (size_t s = 0; s <= max_bucket; ++s) {
+    size_start[s + 1] += size_start[s];
+  }
+  for (size_t b = 0; b < bucket_count; ++b) {
+    by_size[size_start[max_bucket - (bucket_start[b + 1] - bucket_start[b])]++] = b;
+  }
+  // search each bucket's displacement
+  bool* taken = new bool[length];
+  for (size_t i = 0; i < length; ++i) {
+    taken[i] = false;
+  }
+  size_t* slots = new size_t[max_bucket];
+  size_t next_free = 0;
+  bool failed = false;
+  for (size_t j = 0; j < bucket_count && !failed; ++j) {
+    size_t b = by_size[j];
+    size_t first = bucket_start[b];
+    size_t count = bucket_start[b + 1] - first;
+    if (count == 0) {
+      displacements[b] = 0;
+    } else if (count == 1) {
+      //single keys go straight into the next leftover slot
+      while (taken[next_free]) {
+        next_free++;
+      }
+      slots[0] = next_free;
+      displacements[b] = DIRECT | (unsigned int)next_free;
+    } else {
+      //keys with equal codes land on the same slot under every
+      //displacement, so there is nothing to search for
+      for (size_t i = 1; i < count && !failed; ++i) {
+        for (size_t k = 0; k < i && !failed; ++k) {
+          failed = codes[order[first + i]] == codes[order[first + k]];
+        }
+      }
+      //try displacements until every key lands on a distinct free slot
+      //(any at or above DIRECT would read as a slot index)
+      unsigned int d = 0;
+      bool placed = false;
+      while (!failed && !placed && d < DIRECT) {
+        placed = true;
+        for (size_t i = 0; i < count && placed; ++i) {
+          slots[i] = slot(codes[order[first + i]], d);
+          if (taken[slots[i]]) {
+            placed = false;
+          }
+          for (size_t k = 0; k < i && placed; ++k) {
+            if (slots[k] == slots[i]) {
+              placed = false;
+            }
+          }
+        }
+        if (!placed) {
+          d++;
+        }
+      }
+      if (!placed) {
+        failed = true;
+        break;
+      }
+      displacements[b] = d;
+    }
+    // fill the chosen slots
+    for (size_t i = 0; i < count; ++i) {
+      size_t index = order[first + i];
+      taken[slots[i]] = true;
+      slot_keys[slots[i]] = all_pairs[index].first;
+      slot_values[slots[i]] = all_pairs[index].second;
+    }
+  }
+  delete [] slots;
+  delete [] taken;
+  delete [] size_start;
+  delete [] by_size;
+  delete [] fill;
+  delete [] order;
+  delete [] bucket_start;
+  delete [] codes;
+  if (failed) {
+    make_empty();
+    throw invalid_argument("PerfectHashCollection: keys can't be separated");
+  }
+}
+
+template<typename K, typename V>
+void PerfectHashCollection<K,V>::make_empty() {
+  delete [] slot_keys;
+  delete [] slot_values;
+  delete [] displacements;
+  slot_keys = nullptr;
+  slot_values = nullptr;
+  displacements = nullptr;
+  bucket_count = 0;
+  length = 0;
+}
+
+#endif
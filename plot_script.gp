@@ -48,5 +48,7 @@ plot infile u 1:2 t "ArrayList Collection" w linespoints pointtype 7, \
      infile u 1:5 t "HashTable Collection" w linespoints pointtype 7, \
      infile u 1:6 t "BST Collection" w linespoints pointtype 7,\
      infile u 1:7 t "AVL Collection" w linespoints pointtype 7, \
-     infile u 1:8 t "RBT Collection" w linespoints pointtype 7
+     infile u 1:8 t "RBT Collection" w linespoints pointtype 7, \
+     infile u 1:9 t "BTree Collection" w linespoints pointtype 7, \
+     infile u 1:10 t "PMA Collection" w linespoints pointtype 7
      
@@ -47,7 +47,8 @@ set yrange [0:30] noreverse writeback
 set key bottom right
 
 plot infile u 2:xticlabels(1) t "AVL Height" pointtype 7, \
-     infile u 3:xticlabels(1) t "RBT Height" pointtype 7
+     infile u 3:xticlabels(1) t "RBT Height" pointtype 7, \
+     infile u 4:xticlabels(1) t "BTree Height" pointtype 7
 
 
 
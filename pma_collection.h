@@ -0,0 +1,357 @@
+//----------------------------------------------------------------------
+// FILE: pma_collection.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a version of the collection class using a packed
+//        memory array: a sorted array split into equal segments, each
+//        packed to the left with free slots at its end. An add only
+//        shifts the elements of one segment. When a segment gets full
+//        (or too sparse after removes) the smallest enclosing window of
+//        segments whose density is within bounds is respread evenly,
+//        and if the whole array is out of bounds it is rebuilt at a new
+//        size. This gives amortized O(log^2 n) adds and removes while
+//        keys stay in one contiguous array for searching and scanning.
+//        Values are kept in a separate array in the same positions.
+//----------------------------------------------------------------------
+
+#ifndef PMA_COLLECTION_H
+#define PMA_COLLECTION_H
+
+#include "collection.h"
+#include "array_list.h"
+#include <utility>
+
+using namespace std;
+
+template<typename K, typename V>
+class PMACollection : public Collection<K,V>
+{
+  public:
+    PMACollection();
+    PMACollection(const PMACollection<K,V>& rhs);
+    ~PMACollection();
+    PMACollection& operator=(const PMACollection<K,V>& rhs);
+
+    // keys are unique, so adding an existing key is ignored
+    void add(const K& key, const V& val);
+    void remove(const K& key);
+    bool find(const K& key, V& val) const;
+    void find(const K& k1, const K& k2, ArrayList<K>& keys) const;
+    void keys(ArrayList<K>& all_keys) const;
+    void sort(ArrayList<K>& all_keys_sorted) const;
+    size_t size() const;
+
+  private:
+    static const size_t MIN_SEGMENT_SIZE = 8;
+    // density bounds for a single segment and for the whole array, the
+    // bounds for windows in between are interpolated by level
+    static constexpr double LEAF_LOWER = 0.125;
+    static constexpr double LEAF_UPPER = 1.0;
+    static constexpr double ROOT_LOWER = 0.2;
+    static constexpr double ROOT_UPPER = 0.7;
+    // density to rebuild at
+    static constexpr double REBUILD_DENSITY = 0.4;
+    // segment s holds counts[s] items starting at s * segment_size
+    K* keys_array;
+    V* values;
+    size_t* counts;
+    size_t segment_size;
+    size_t segment_count;
+    // levels of windows above the segments (segment_count = 2^height)
+    size_t tree_height;
+    size_t length;
+    // find the segment and position of the first key >= key
+    bool locate(const K& key, size_t& seg, size_t& pos) const;
+    double lower_density(size_t level) const;
+    double upper_density(size_t level) const;
+    // restore the density bounds after seg changed size
+    void rebalance(size_t seg);
+    // move the items of window segments starting at first out to (or
+    // back evenly from) temporary arrays
+    void gather(size_t first, size_t window, K* tmp_keys, V* tmp_values);
+    void scatter(size_t first, size_t window, K* tmp_keys, V* tmp_values,
+                 size_t total);
+    // reallocate to suit the current length
+    void rebuild();
+    void allocate(size_t new_segment_count, size_t new_segment_size);
+    void make_empty();
+};
+
+template<typename K, typename V>
+PMACollection<K,V>::PMACollection()
+  : length(0)
+{
+  allocate(1, MIN_SEGMENT_SIZE);
+}
+
+template<typename K, typename V>
+PMACollection<K,V>::PMACollection(const PMACollection<K,V>& rhs)
+  : keys_array(nullptr), values(nullptr), counts(nullptr), segment_size(0),
+    segment_count(0), tree_height(0), length(0)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+template<typename K, typename V>
+PMACollection<K,V>::~PMACollection() {
+  make_empty();
+}
+
+template<typename K, typename V>
+PMACollection<K,V>& PMACollection<K,V>::operator=(const PMACollection<K,V>& rhs) {
+  if (this != &rhs) {
+    make_empty();
+    allocate(rhs.segment_count, rhs.segment_size);
+    //same layout, so copy slot for slot
+    for (size_t s = 0; s < segment_count; ++s) {
+      counts[s] = rhs.counts[s];
+      for (size_t i = s * segment_size; i < s * segment_size + counts[s]; ++i) {
+        keys_array[i] = rhs.keys_array[i];
+        values[i] = rhs.values[i];
+      }
+    }
+    length = rhs.length;
+  }
+  return *this;
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::add(const K& key, const V& val) {
+  size_t seg, pos;
+  if (locate(key, seg, pos)) {
+    return;
+  }
+  //shift the rest of the segment right one (there is always a free slot)
+  size_t base = seg * segment_size;
+  for (size_t i = counts[seg]; i > pos; --i) {
+    keys_array[base + i] = std::move(keys_array[base + i - 1]);
+    values[base + i] = std::move(values[base + i - 1]);
+  }
+  keys_array[base + pos] = key;
+  values[base + pos] = val;
+  counts[seg]++;
+  length = length + 1;
+  rebalance(seg);
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::remove(const K& key) {
+  size_t seg, pos;
+  if (!locate(key, seg, pos)) {
+    return;
+  }
+  //shift the rest of the segment left one
+  size_t base = seg * segment_size;
+  for (size_t i = pos; i + 1 < counts[seg]; ++i) {
+    keys_array[base + i] = std::move(keys_array[base + i + 1]);
+    values[base + i] = std::move(values[base + i + 1]);
+  }
+  counts[seg]--;
+  length = length - 1;
+  rebalance(seg);
+}
+
+template<typename K, typename V>
+bool PMACollection<K,V>::find(const K& key, V& val) const {
+  size_t seg, pos;
+  if (locate(key, seg, pos)) {
+    val = values[seg * segment_size + pos];
+    return true;
+  }
+  return false;
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::find(const K& k1, const K& k2, ArrayList<K>& keys) const {
+  size_t seg, pos;
+  locate(k1, seg, pos);
+  //scan forward from the first key >= k1, skipping the free slots
+  for (; seg < segment_count; ++seg, pos = 0) {
+    for (size_t i = seg * segment_size + pos; i < seg * segment_size + counts[seg]; ++i) {
+      if (keys_array[i] > k2) {
+        return;
+      }
+      keys.add(keys_array[i]);
+    }
+  }
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::keys(ArrayList<K>& all_keys) const {
+  for (size_t s = 0; s < segment_count; ++s) {
+    for (size_t i = s * segment_size; i < s * segment_size + counts[s]; ++i) {
+      all_keys.add(keys_array[i]);
+    }
+  }
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::sort(ArrayList<K>& all_keys_sorted) const {
+  //get all keys, array already sorted
+  keys(all_keys_sorted);
+}
+
+template<typename K, typename V>
+size_t PMACollection<K,V>::size() const {
+  return length;
+}
+
+template<typename K, typename V>
+bool PMACollection<K,V>::locate(const K& key, size_t& seg, size_t& pos) const {
+  //binary search for the last segment starting at or before key (only
+  //a lone segment can be empty, so every first slot holds a key)
+  size_t low = 0;
+  size_t high = segment_count;
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+    if (counts[mid] > 0 && keys_array[mid * segment_size] <= key) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  seg = (low == 0) ? 0 : low - 1;
+  //then binary search within the segment
+  size_t base = seg * segment_size;
+  low = 0;
+  high = counts[seg];
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+    if (keys_array[base + mid] < key) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  pos = low;
+  return pos < counts[seg] && keys_array[base + pos] == key;
+}
+
+template<typename K, typename V>
+double PMACollection<K,V>::lower_density(size_t level) const {
+  return LEAF_LOWER + (ROOT_LOWER - LEAF_LOWER) * level / tree_height;
+}
+
+template<typename K, typename V>
+double PMACollection<K,V>::upper_density(size_t level) const {
+  return LEAF_UPPER - (LEAF_UPPER - ROOT_UPPER) * level / tree_height;
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::rebalance(size_t seg) {
+  //a segment is fine if it still has a free slot and isn't too sparse
+  if (counts[seg] < segment_size &&
+      (segment_count == 1 || counts[seg] >= LEAF_LOWER * segment_size)) {
+    return;
+  }
+  //find the smallest enclosing window within its density bounds, and
+  //with a free slot per segment once spread out
+  for (size_t level = 1; level <= tree_height; ++level) {
+    size_t window = (size_t)1 << level;
+    size_t first = seg / window * window;
+    size_t total = 0;
+    for (size_t s = first; s < first + window; ++s) {
+      total += counts[s];
+    }
+    double density = total * 1.0 / (window * segment_size);
+    if (density >= lower_density(level) && density <= upper_density(level) &&
+        total <= window * (segment_size - 1)) {
+      K* tmp_keys = new K[total];
+      V* tmp_values = new V[total];
+      gather(first, window, tmp_keys, tmp_values);
+      scatter(first, window, tmp_keys, tmp_values, total);
+      delete [] tmp_keys;
+      delete [] tmp_values;
+      return;
+    }
+  }
+  //the whole array is too full or too sparse
+  rebuild();
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::gather(size_t first, size_t window, K* tmp_keys,
+V* tmp_values) {
+  size_t j = 0;
+  for (size_t s = first; s < first + window; ++s) {
+    for (size_t i = s * segment_size; i < s * segment_size + counts[s]; ++i) {
+      tmp_keys[j] = std::move(keys_array[i]);
+      tmp_values[j] = std::move(values[i]);
+      j++;
+    }
+  }
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::scatter(size_t first, size_t window, K* tmp_keys,
+V* tmp_values, size_t total) {
+  //every segment gets total / window items, and the first few one more
+  size_t j = 0;
+  for (size_t s = first; s < first + window; ++s) {
+    counts[s] = total / window + ((s - first < total % window) ? 1 : 0);
+    for (size_t i = s * segment_size; i < s * segment_size + counts[s]; ++i) {
+      keys_array[i] = std::move(tmp_keys[j]);
+      values[i] = std::move(tmp_values[j]);
+      j++;
+    }
+  }
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::rebuild() {
+  //segments of about log n slots, and enough of them to bring the
+  //density down to the rebuild density
+  size_t log_n = 0;
+  while (((size_t)1 << log_n) < length) {
+    log_n++;
+  }
+  size_t new_segment_size = MIN_SEGMENT_SIZE;
+  while (new_segment_size < log_n) {
+    new_segment_size *= 2;
+  }
+  size_t new_segment_count = 1;
+  while (new_segment_count * new_segment_size * REBUILD_DENSITY < length) {
+    new_segment_count *= 2;
+  }
+  size_t total = length;
+  K* tmp_keys = new K[total];
+  V* tmp_values = new V[total];
+  gather(0, segment_count, tmp_keys, tmp_values);
+  make_empty();
+  allocate(new_segment_count, new_segment_size);
+  scatter(0, segment_count, tmp_keys, tmp_values, total);
+  length = total;
+  delete [] tmp_keys;
+  delete [] tmp_values;
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::allocate(size_t new_segment_count, size_t new_segment_size) {
+  segment_count = new_segment_count;
+  segment_size = new_segment_size;
+  keys_array = new K[segment_count * segment_size];
+  values = new V[segment_count * segment_size];
+  counts = new size_t[segment_count];
+  for (size_t s = 0; s < segment_count; ++s) {
+    counts[s] = 0;
+  }
+  tree_height = 0;
+  while (((size_t)1 << tree_height) < segment_count) {
+    tree_height++;
+  }
+}
+
+template<typename K, typename V>
+void PMACollection<K,V>::make_empty() {
+  delete [] keys_array;
+  delete [] values;
+  delete [] counts;
+  keys_array = nullptr;
+  values = nullptr;
+  counts = nullptr;
+  segment_count = 0;
+  length = 0;
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include "string.h"
 #include "collection.h"
 #include "array_list.h"
+#include "value_holder.h"
 
 
 template<typename K, typename V>
@@ -44,6 +45,8 @@ public:
   size_t size() const;
   // return the height of the tree
   size_t height() const;
+  // merge a batch with the existing keys and rebuild balanced
+  void add_batch(const ArrayList<std::pair<K,V>>& batch);
 
   // for testing:
   // check if tree satisfies the red-black tree constraints
@@ -55,13 +58,13 @@ private:
   
   // RBT node structure
   enum color_t {RED, BLACK};
-  struct Node {
+  // value comes from ValueHolder (and takes no space for empty V)
+  struct Node : ValueHolder<V> {
     K key;
-    V value;
+    color_t color;
     Node* left;
     Node* right;
     Node* parent;
-    color_t color;
   };
   // root node
   Node* root;
@@ -85,6 +88,10 @@ private:
   void remove_rebalance(Node* x, bool going_right);
   // height helper
   size_t height(Node* subtree_root) const;
+  // helper to link nodes[start, end) into a balanced subtree, coloring
+  // the nodes at red_depth red
+  Node* build(Node** nodes, size_t start, size_t end, Node* parent,
+              size_t depth, size_t red_depth);
   
   // ------------
   // for testing:
@@ -509,6 +516,41 @@ void RBTCollection<K,V>::remove_rebalance(Node* x, bool going_right) {
   }
 }
   
+template<typename K, typename V>
+void RBTCollection<K,V>::add_batch(const ArrayList<std::pair<K,V>>& batch) {
+  //existing and new nodes in key order
+  size_t count;
+  Node** nodes = this->merge_batch(root, node_count, batch, count);
+  //relink everything as a balanced tree. Every root-to-leaf path has
+  //floor(log2(count + 1)) nodes above the bottom level, so making only
+  //the nodes on a partly filled bottom level red keeps black heights
+  //equal with no red node having a red child.
+  size_t red_depth = 0;
+  while (((size_t)2 << red_depth) <= count + 1) {
+    red_depth++;
+  }
+  root = build(nodes, 0, count, nullptr, 0, red_depth);
+  node_count = count;
+  delete [] nodes;
+}
+
+template<typename K, typename V>
+typename RBTCollection<K,V>::Node*
+RBTCollection<K,V>::build(Node** nodes, size_t start, size_t end, Node* parent,
+size_t depth, size_t red_depth) {
+  if (start == end) {
+    return nullptr;
+  }
+  //middle node is the root, each half becomes a subtree
+  size_t mid = start + (end - start) / 2;
+  Node* subtree_root = nodes[mid];
+  subtree_root->parent = parent;
+  subtree_root->color = (depth == red_depth) ? RED : BLACK;
+  subtree_root->left = build(nodes, start, mid, subtree_root, depth + 1, red_depth);
+  subtree_root->right = build(nodes, mid + 1, end, subtree_root, depth + 1, red_depth);
+  return subtree_root;
+}
+
 template<typename K, typename V>
 size_t RBTCollection<K,V>::height(Node* subtree_root) const {
   //base case
@@ -0,0 +1,191 @@
+//----------------------------------------------------------------------
+// FILE: search_policy.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Search strategies for the sorted keys of BinSearchCollection,
+//        picked at compile time by its Search template parameter. Each
+//        policy has a static lower_bound that returns the index of the
+//        first key >= key (or the size if there is none):
+//          BranchySearch:        classic binary search with if/else
+//          BranchlessSearch:     binary search whose only branch is the
+//                                loop test (the narrowing step is a
+//                                conditional move), so nothing to
+//                                mispredict on random lookups
+//          KarySearch:           splits the range into 8 blocks per
+//                                step, prefetching all 7 pivots so their
+//                                cache misses overlap instead of
+//                                happening one after another
+//          InterpolationSearch:  guesses the position from the key's
+//                                value, for integer keys and fixed-width
+//                                string keys, falling back to halving
+//                                when a guess doesn't help much
+//----------------------------------------------------------------------
+
+#ifndef SEARCH_POLICY_H
+#define SEARCH_POLICY_H
+
+#include "array_list.h"
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+
+struct BranchySearch
+{
+  template<typename K>
+  static size_t lower_bound(const ArrayList<K>& keys, const K& key);
+};
+
+
+struct BranchlessSearch
+{
+  template<typename K>
+  static size_t lower_bound(const ArrayList<K>& keys, const K& key);
+};
+
+
+struct KarySearch
+{
+  // blocks per step
+  static const size_t WAYS = 8;
+  template<typename K>
+  static size_t lower_bound(const ArrayList<K>& keys, const K& key);
+};
+
+
+struct InterpolationSearch
+{
+  template<typename K>
+  static size_t lower_bound(const ArrayList<K>& keys, const K& key);
+  // position of a key on a number line that preserves key order
+  template<typename K>
+  static double value(const K& key);
+};
+
+
+template<typename K>
+size_t BranchySearch::lower_bound(const ArrayList<K>& keys, const K& key)
+{
+  size_t low = 0;
+  size_t high = keys.size();
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+    if (keys[mid] < key)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  return low;
+}
+
+
+template<typename K>
+size_t BranchlessSearch::lower_bound(const ArrayList<K>& keys, const K& key)
+{
+  size_t length = keys.size();
+  if (length == 0)
+    return 0;
+  // the answer is in [base, base + length]; every step halves length
+  // whether or not base moves, so the trip count only depends on size
+  size_t base = 0;
+  while (length > 1) {
+    size_t half = length / 2;
+    base = (keys[base + half] < key) ? base + half : base;
+    length -= half;
+  }
+  return base + (keys[base] < key);
+}
+
+
+template<typename K>
+size_t KarySearch::lower_bound(const ArrayList<K>& keys, const K& key)
+{
+  size_t low = 0;
+  size_t length = keys.size();
+  while (length > WAYS) {
+    size_t step = length / WAYS;
+    // pivot i is the last key of block i - 1
+    for (size_t i = 1; i < WAYS; ++i)
+      __builtin_prefetch(&keys[low + i * step - 1]);
+    // count the blocks that are entirely less than key
+    size_t skip = 0;
+    for (size_t i = 1; i < WAYS; ++i)
+      skip += (keys[low + i * step - 1] < key);
+    low += skip * step;
+    // the last block also takes the leftover keys
+    length = (skip == WAYS - 1) ? length - skip * step : step;
+  }
+  // short scan of the final block
+  while (length > 0 && keys[low] < key) {
+    low++;
+    length--;
+  }
+  return low;
+}
+
+
+template<typename K>
+size_t InterpolationSearch::lower_bound(const ArrayList<K>& keys, const K& key)
+{
+  // the answer is in [low, high]
+  size_t low = 0;
+  size_t high = keys.size();
+  double key_value = value(key);
+  while (low < high) {
+    if (!(keys[low] < key))
+      return low;
+    if (keys[high - 1] < key)
+      return high;
+    // now keys[low] < key <= keys[high - 1], so the answer is in
+    // [low + 1, high - 1]
+    size_t before = high - low;
+    double low_value = value(keys[low]);
+    double high_value = value(keys[high - 1]);
+    size_t guess = low + (high - low) / 2;
+    if (high_value > low_value) {
+      double fraction = (key_value - low_value) / (high_value - low_value);
+      guess = low + (size_t)(fraction * (high - 1 - low));
+    }
+    if (guess < low + 1)
+      guess = low + 1;
+    if (guess > high - 1)
+      guess = high - 1;
+    if (keys[guess] < key)
+      low = guess + 1;
+    else
+      high = guess;
+    // skewed keys can make guesses crawl, so halve when one doesn't
+    if (high - low > before / 2 && low < high) {
+      size_t mid = low + (high - low) / 2;
+      if (keys[mid] < key)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+  }
+  return low;
+}
+
+
+template<typename K>
+double InterpolationSearch::value(const K& key)
+{
+  if constexpr (is_arithmetic<K>::value) {
+    return (double) key;
+  } else {
+    static_assert(is_same<K, string>::value,
+                  "interpolation search needs numeric or string keys");
+    // the leading 8 characters as a big-endian number
+    unsigned long long prefix = 0;
+    for (size_t i = 0; i < 8; ++i) {
+      prefix <<= 8;
+      if (i < key.size())
+        prefix |= (unsigned char) key[i];
+    }
+    return (double) prefix;
+  }
+}
+
+
+#endif
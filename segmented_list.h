@@ -0,0 +1,248 @@
+//----------------------------------------------------------------------
+// FILE: segmented_list.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements a version of the list class that stores items in a
+//       directory of segments instead of one array. Segment k holds
+//       FIRST_SEGMENT << k items, so the segments double in size and
+//       the segment and offset for an index come from its highest set
+//       bit. Growing only allocates the next segment; nothing is ever
+//       copied, so every append is O(1) (no resize stalls) and an item
+//       stays at the same address until it is removed or shifted by an
+//       add or remove at a lower index.
+//----------------------------------------------------------------------
+
+#ifndef SEGMENTED_LIST_H
+#define SEGMENTED_LIST_H
+
+#include "list.h"
+#include "array_list.h"
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+using namespace std;
+
+template<typename T>
+class SegmentedList : public List<T>
+{
+public:
+  SegmentedList();
+  SegmentedList(const SegmentedList<T>& rhs);
+  ~SegmentedList();
+  SegmentedList& operator=(const SegmentedList<T>& rhs);
+
+  void add(const T& item);
+  bool add(size_t index, const T& item);
+  bool get(size_t index, T& return_item) const;
+  // unchecked access by reference (index must be < size())
+  T& operator[](size_t index);
+  const T& operator[](size_t index) const;
+  bool set(size_t index, const T& new_item);
+  bool remove(size_t index);
+  size_t size() const;
+  void sort();
+
+private:
+  // items in the first segment (a power of two)
+  static const size_t FIRST_SEGMENT = 16;
+  static const size_t FIRST_SEGMENT_BITS = 4;
+  // enough segments for any size_t index
+  static const size_t MAX_SEGMENTS = 8 * sizeof(size_t) - FIRST_SEGMENT_BITS;
+  // segment directory; only the first segment_count are allocated
+  T* segments[MAX_SEGMENTS];
+  size_t segment_count;
+  size_t length;
+
+  // segment and offset within it of the item at index
+  static void locate(size_t index, size_t& segment, size_t& offset);
+  // end every item and free every segment
+  void make_empty();
+};
+
+
+template<typename T>
+SegmentedList<T>::SegmentedList()
+  : segment_count(0), length(0)
+{
+}
+
+
+template<typename T>
+SegmentedList<T>::SegmentedList(const SegmentedList<T>& rhs)
+  : segment_count(0), length(0)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+
+template<typename T>
+SegmentedList<T>::~SegmentedList()
+{
+  make_empty();
+}
+
+
+template<typename T>
+SegmentedList<T>& SegmentedList<T>::operator=(const SegmentedList<T>& rhs)
+{
+  if (this != &rhs) {
+    make_empty();
+    for (size_t i = 0; i < rhs.length; ++i) {
+      add(rhs[i]);
+    }
+  }
+  return *this;
+}
+
+
+template<typename T>
+void SegmentedList<T>::add(const T& item)
+{
+  size_t segment, offset;
+  locate(length, segment, offset);
+  // the next segment is allocated, never the existing ones moved
+  if (segment == segment_count) {
+    size_t capacity = FIRST_SEGMENT << segment;
+    T* storage = static_cast<T*>(malloc(capacity * sizeof(T)));
+    if (storage == nullptr) {
+      throw bad_alloc();
+    }
+    segments[segment] = storage;
+    segment_count++;
+  }
+  new (segments[segment] + offset) T(item);
+  length++;
+}
+
+
+template<typename T>
+bool SegmentedList<T>::add(size_t index, const T& item)
+{
+  if (index > length) {
+    return false;
+  }
+  // copied first, since item may be in this list
+  T copy(item);
+  if (index == length) {
+    add(copy);
+    return true;
+  }
+  // append the last item again, then shift the rest up by one
+  add((*this)[length - 1]);
+  for (size_t i = length - 2; i > index; --i) {
+    (*this)[i] = std::move((*this)[i - 1]);
+  }
+  (*this)[index] = std::move(copy);
+  return true;
+}
+
+
+template<typename T>
+bool SegmentedList<T>::get(size_t index, T& return_item) const
+{
+  if (index >= length) {
+    return false;
+  }
+  return_item = (*this)[index];
+  return true;
+}
+
+
+template<typename T>
+T& SegmentedList<T>::operator[](size_t index)
+{
+  size_t segment, offset;
+  locate(index, segment, offset);
+  return segments[segment][offset];
+}
+
+
+template<typename T>
+const T& SegmentedList<T>::operator[](size_t index) const
+{
+  size_t segment, offset;
+  locate(index, segment, offset);
+  return segments[segment][offset];
+}
+
+
+template<typename T>
+bool SegmentedList<T>::set(size_t index, const T& new_item)
+{
+  if (index >= length) {
+    return false;
+  }
+  (*this)[index] = new_item;
+  return true;
+}
+
+
+template<typename T>
+bool SegmentedList<T>::remove(size_t index)
+{
+  if (index >= length) {
+    return false;
+  }
+  // shift everything after index down by one, then end the last item
+  // (its segment is kept for the next append)
+  for (size_t i = index; i < length - 1; ++i) {
+    (*this)[i] = std::move((*this)[i + 1]);
+  }
+  (*this)[length - 1].~T();
+  length--;
+  return true;
+}
+
+
+template<typename T>
+size_t SegmentedList<T>::size() const
+{
+  return length;
+}
+
+
+template<typename T>
+void SegmentedList<T>::sort()
+{
+  // sort a contiguous copy (so it gets ArrayList's sorts), then move
+  // the sorted items back into place (ArrayList's add only copies)
+  ArrayList<T> items;
+  items.reserve(length);
+  for (size_t i = 0; i < length; ++i) {
+    items.add((*this)[i]);
+  }
+  items.sort();
+  for (size_t i = 0; i < length; ++i) {
+    (*this)[i] = std::move(items[i]);
+  }
+}
+
+
+template<typename T>
+void SegmentedList<T>::locate(size_t index, size_t& segment, size_t& offset)
+{
+  // segment k starts at FIRST_SEGMENT * (2^k - 1), so index +
+  // FIRST_SEGMENT has its highest bit at FIRST_SEGMENT_BITS + k
+  size_t shifted = index + FIRST_SEGMENT;
+  size_t high_bit = 8 * sizeof(size_t) - 1 - __builtin_clzl(shifted);
+  segment = high_bit - FIRST_SEGMENT_BITS;
+  offset = shifted - ((size_t) 1 << high_bit);
+}
+
+
+template<typename T>
+void SegmentedList<T>::make_empty()
+{
+  for (size_t i = 0; i < length; ++i) {
+    (*this)[i].~T();
+  }
+  for (size_t i = 0; i < segment_count; ++i) {
+    free(segments[i]);
+  }
+  segment_count = 0;
+  length = 0;
+}
+
+#endif
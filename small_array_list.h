@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------
+// FILE: small_array_list.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: An ArrayList with room for N items inside the list object
+//       itself. Until it holds more than N items it never touches the
+//       heap, which makes it a cheap place to collect small results
+//       (such as most range finds). It can be passed anywhere an
+//       ArrayList is expected.
+//----------------------------------------------------------------------
+
+#ifndef SMALL_ARRAY_LIST_H
+#define SMALL_ARRAY_LIST_H
+
+#include "array_list.h"
+
+using namespace std;
+
+template<typename T, size_t N = 16>
+class SmallArrayList : public ArrayList<T>
+{
+public:
+  SmallArrayList();
+  SmallArrayList(const SmallArrayList<T,N>& rhs);
+  SmallArrayList& operator=(const SmallArrayList<T,N>& rhs);
+
+private:
+  // raw storage for the first N items (ArrayList constructs them)
+  alignas(T) unsigned char buffer[N * sizeof(T)];
+};
+
+
+template<typename T, size_t N>
+SmallArrayList<T,N>::SmallArrayList()
+  : ArrayList<T>(reinterpret_cast<T*>(buffer), N)
+{
+}
+
+
+template<typename T, size_t N>
+SmallArrayList<T,N>::SmallArrayList(const SmallArrayList<T,N>& rhs)
+  : ArrayList<T>(reinterpret_cast<T*>(buffer), N)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+
+template<typename T, size_t N>
+SmallArrayList<T,N>& SmallArrayList<T,N>::operator=(const SmallArrayList<T,N>& rhs)
+{
+  ArrayList<T>::operator=(rhs);
+  return *this;
+}
+
+#endif
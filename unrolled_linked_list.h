@@ -0,0 +1,430 @@
+//----------------------------------------------------------------------
+// FILE: unrolled_linked_list.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Implements an unrolled linked list version of the list class.
+//       Each node holds a small array of items (about a cache line's
+//       worth), so a traversal takes one cache miss per node instead of
+//       one per item, and indexing skips a whole node at a time. A full
+//       node splits in half on an insert, and a node that drops below
+//       half full takes in its successor's items if they fit. Nodes
+//       come from a pool owned by the list: they are allocated in
+//       blocks, and removed nodes are kept on a free list for reuse.
+//----------------------------------------------------------------------
+
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include "list.h"
+#include "array_list.h"
+#include <new>
+#include <utility>
+
+using namespace std;
+
+template<typename T>
+class UnrolledLinkedList : public List<T>
+{
+  struct Node;
+
+public:
+  // forward iterator over the items (Item is T or const T)
+  template<typename Item>
+  class Iterator
+  {
+  public:
+    Item& operator*() const {return node->items()[offset];}
+    Item* operator->() const {return node->items() + offset;}
+    Iterator& operator++();
+    bool operator==(const Iterator& rhs) const {return node == rhs.node && offset == rhs.offset;}
+    bool operator!=(const Iterator& rhs) const {return !(*this == rhs);}
+  private:
+    friend class UnrolledLinkedList<T>;
+    Iterator(Node* node, size_t offset) : node(node), offset(offset) {}
+    Node* node;
+    size_t offset;
+  };
+  typedef Iterator<T> iterator;
+  typedef Iterator<const T> const_iterator;
+
+  UnrolledLinkedList();
+  UnrolledLinkedList(const UnrolledLinkedList<T>& rhs);
+  ~UnrolledLinkedList();
+  UnrolledLinkedList& operator=(const UnrolledLinkedList<T>& rhs);
+
+  void add(const T& item);
+  bool add(size_t index, const T& item);
+  bool get(size_t index, T& return_item) const;
+  bool set(size_t index, const T& new_item);
+  bool remove(size_t index);
+  size_t size() const;
+  void sort();
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+private:
+  // items per node: what fits in a 64-byte node after the header, but
+  // at least 4 so large items still share nodes
+  static const size_t NODE_BYTES = 64;
+  static const size_t HEADER_BYTES = sizeof(void*) + sizeof(size_t);
+  static const size_t NODE_ITEMS = (NODE_BYTES - HEADER_BYTES) / sizeof(T) > 4 ?
+    (NODE_BYTES - HEADER_BYTES) / sizeof(T) : 4;
+  // nodes per pool allocation
+  static const size_t BLOCK_NODES = 64;
+
+  // aligned so each node starts a cache line (new Block uses the
+  // aligned operator new)
+  struct alignas(NODE_BYTES) Node {
+    Node* next;
+    // items()[0 .. count) are constructed
+    size_t count;
+    alignas(T) unsigned char storage[NODE_ITEMS * sizeof(T)];
+    T* items() {return reinterpret_cast<T*>(storage);}
+    const T* items() const {return reinterpret_cast<const T*>(storage);}
+  };
+  struct Block {
+    Node nodes[BLOCK_NODES];
+    // next block, for freeing them all (Node's alignment pads this to
+    // a full line on either side of the nodes)
+    Block* next;
+  };
+
+  Node* head;
+  Node* tail;
+  size_t length;
+  // pool: every block allocated, and the nodes not in the list
+  Block* blocks;
+  Node* free_nodes;
+
+  //helper functions
+  void make_empty();
+  // empty node from the pool, and back to the pool
+  Node* new_node();
+  void delete_node(Node* node);
+  // node holding index (< length), and the index's offset within it
+  Node* find_node(size_t index, size_t& offset) const;
+};
+
+
+template<typename T>
+template<typename Item>
+typename UnrolledLinkedList<T>::template Iterator<Item>&
+UnrolledLinkedList<T>::Iterator<Item>::operator++()
+{
+  offset++;
+  // nodes are never empty, so end() is (null, 0)
+  if (offset == node->count) {
+    node = node->next;
+    offset = 0;
+  }
+  return *this;
+}
+
+
+template<typename T>
+UnrolledLinkedList<T>::UnrolledLinkedList()
+  : head(nullptr), tail(nullptr), length(0), blocks(nullptr),
+    free_nodes(nullptr)
+{
+}
+
+
+template<typename T>
+UnrolledLinkedList<T>::UnrolledLinkedList(const UnrolledLinkedList<T>& rhs)
+  : head(nullptr), tail(nullptr), length(0), blocks(nullptr),
+    free_nodes(nullptr)
+{
+  // defer to assignment operator
+  *this = rhs;
+}
+
+
+template<typename T>
+UnrolledLinkedList<T>::~UnrolledLinkedList()
+{
+  make_empty();
+  while (blocks != nullptr) {
+    Block* next_block = blocks->next;
+    delete blocks;
+    blocks = next_block;
+  }
+}
+
+
+template<typename T>
+UnrolledLinkedList<T>& UnrolledLinkedList<T>::operator=(const UnrolledLinkedList<T>& rhs)
+{
+  if (this != &rhs) {
+    make_empty();
+    for (const T& item : rhs) {
+      add(item);
+    }
+  }
+  return *this;
+}
+
+
+template<typename T>
+void UnrolledLinkedList<T>::add(const T& item)
+{
+  // copied first, since item may be in this list
+  T copy(item);
+  if (tail == nullptr || tail->count == NODE_ITEMS) {
+    Node* node = new_node();
+    if (tail == nullptr) {
+      head = node;
+    } else {
+      tail->next = node;
+    }
+    tail = node;
+  }
+  new (tail->items() + tail->count) T(std::move(copy));
+  tail->count++;
+  length++;
+}
+
+
+template<typename T>
+bool UnrolledLinkedList<T>::add(size_t index, const T& item)
+{
+  if (index > length) {
+    return false;
+  }
+  if (index == length) {
+    add(item);
+    return true;
+  }
+  T copy(item);
+  size_t offset;
+  Node* node = find_node(index, offset);
+  // split a full node, moving its upper half into a new next node
+  if (node->count == NODE_ITEMS) {
+    Node* upper = new_node();
+    size_t keep = NODE_ITEMS / 2;
+    for (size_t i = keep; i < NODE_ITEMS; ++i) {
+      new (upper->items() + (i - keep)) T(std::move(node->items()[i]));
+      node->items()[i].~T();
+    }
+    upper->count = NODE_ITEMS - keep;
+    node->count = keep;
+    upper->next = node->next;
+    node->next = upper;
+    if (tail == node) {
+      tail = upper;
+    }
+    if (offset > keep) {
+      node = upper;
+      offset -= keep;
+    }
+  }
+  // shift the node's items after offset up by one
+  T* items = node->items();
+  if (offset == node->count) {
+    new (items + offset) T(std::move(copy));
+  } else {
+    new (items + node->count) T(std::move(items[node->count - 1]));
+    for (size_t i = node->count - 1; i > offset; --i) {
+      items[i] = std::move(items[i - 1]);
+    }
+    items[offset] = std::move(copy);
+  }
+  node->count++;
+  length++;
+  return true;
+}
+
+
+template<typename T>
+bool UnrolledLinkedList<T>::get(size_t index, T& return_item) const
+{
+  if (index >= length) {
+    return false;
+  }
+  size_t offset;
+  Node* node = find_node(index, offset);
+  return_item = node->items()[offset];
+  return true;
+}
+
+
+template<typename T>
+bool UnrolledLinkedList<T>::set(size_t index, const T& new_item)
+{
+  if (index >= length) {
+    return false;
+  }
+  size_t offset;
+  Node* node = find_node(index, offset);
+  node->items()[offset] = new_item;
+  return true;
+}
+
+
+template<typename T>
+bool UnrolledLinkedList<T>::remove(size_t index)
+{
+  if (index >= length) {
+    return false;
+  }
+  // find the node and the one before it (to unlink it if it empties)
+  Node* prev = nullptr;
+  Node* node = head;
+  size_t offset = index;
+  while (offset >= node->count) {
+    offset -= node->count;
+    prev = node;
+    node = node->next;
+  }
+  // shift the node's items after offset down by one
+  T* items = node->items();
+  for (size_t i = offset; i + 1 < node->count; ++i) {
+    items[i] = std::move(items[i + 1]);
+  }
+  items[node->count - 1].~T();
+  node->count--;
+  length--;
+  if (node->count == 0) {
+    if (prev == nullptr) {
+      head = node->next;
+    } else {
+      prev->next = node->next;
+    }
+    if (tail == node) {
+      tail = prev;
+    }
+    delete_node(node);
+  } else if (node->count < NODE_ITEMS / 2 && node->next != nullptr &&
+             node->count + node->next->count <= NODE_ITEMS) {
+    // under half full: take in the next node's items
+    Node* next = node->next;
+    for (size_t i = 0; i < next->count; ++i) {
+      new (items + node->count + i) T(std::move(next->items()[i]));
+      next->items()[i].~T();
+    }
+    node->count += next->count;
+    next->count = 0;
+    node->next = next->next;
+    if (tail == next) {
+      tail = node;
+    }
+    delete_node(next);
+  }
+  return true;
+}
+
+
+template<typename T>
+size_t UnrolledLinkedList<T>::size() const
+{
+  return length;
+}
+
+
+template<typename T>
+void UnrolledLinkedList<T>::sort()
+{
+  // sort a contiguous copy (so it gets ArrayList's sorts), then move
+  // the sorted items back into place (ArrayList's add only copies)
+  ArrayList<T> sorted;
+  sorted.reserve(length);
+  for (const T& item : *this) {
+    sorted.add(item);
+  }
+  sorted.sort();
+  size_t i = 0;
+  for (T& item : *this) {
+    item = std::move(sorted[i++]);
+  }
+}
+
+
+template<typename T>
+typename UnrolledLinkedList<T>::iterator UnrolledLinkedList<T>::begin()
+{
+  return iterator(head, 0);
+}
+
+
+template<typename T>
+typename UnrolledLinkedList<T>::iterator UnrolledLinkedList<T>::end()
+{
+  return iterator(nullptr, 0);
+}
+
+
+template<typename T>
+typename UnrolledLinkedList<T>::const_iterator UnrolledLinkedList<T>::begin() const
+{
+  return const_iterator(head, 0);
+}
+
+
+template<typename T>
+typename UnrolledLinkedList<T>::const_iterator UnrolledLinkedList<T>::end() const
+{
+  return const_iterator(nullptr, 0);
+}
+
+
+template<typename T>
+void UnrolledLinkedList<T>::make_empty()
+{
+  // the nodes go back to the pool, which keeps its blocks
+  while (head != nullptr) {
+    Node* next = head->next;
+    for (size_t i = 0; i < head->count; ++i) {
+      head->items()[i].~T();
+    }
+    delete_node(head);
+    head = next;
+  }
+  tail = nullptr;
+  length = 0;
+}
+
+
+template<typename T>
+typename UnrolledLinkedList<T>::Node* UnrolledLinkedList<T>::new_node()
+{
+  // out of free nodes, so allocate another block of them
+  if (free_nodes == nullptr) {
+    Block* block = new Block;
+    block->next = blocks;
+    blocks = block;
+    for (size_t i = 0; i < BLOCK_NODES; ++i) {
+      delete_node(block->nodes + i);
+    }
+  }
+  Node* node = free_nodes;
+  free_nodes = node->next;
+  node->next = nullptr;
+  node->count = 0;
+  return node;
+}
+
+
+template<typename T>
+void UnrolledLinkedList<T>::delete_node(Node* node)
+{
+  node->next = free_nodes;
+  free_nodes = node;
+}
+
+
+template<typename T>
+typename UnrolledLinkedList<T>::Node*
+UnrolledLinkedList<T>::find_node(size_t index, size_t& offset) const
+{
+  // skip whole nodes by their counts
+  Node* node = head;
+  offset = index;
+  while (offset >= node->count) {
+    offset -= node->count;
+    node = node->next;
+  }
+  return node;
+}
+
+#endif
@@ -0,0 +1,49 @@
+//----------------------------------------------------------------------
+// FILE: value_holder.h
+// NAME: Rie Durnil
+// DATE: October, 2026
+// DESC: Base class for collection nodes that holds the node's value.
+//        For an empty value type, such as NoValue for collections used
+//        as sets of keys, the value is one shared static object rather
+//        than a member, so (as an empty base) it adds nothing to the
+//        node. Either way node code reads and writes node->value.
+//----------------------------------------------------------------------
+
+#ifndef VALUE_HOLDER_H
+#define VALUE_HOLDER_H
+
+#include <type_traits>
+
+using namespace std;
+
+
+// value type for key-only collections (all NoValues are equal)
+struct NoValue
+{
+  bool operator<(const NoValue&) const {return false;}
+  bool operator>(const NoValue&) const {return false;}
+  bool operator==(const NoValue&) const {return true;}
+  bool operator!=(const NoValue&) const {return false;}
+};
+
+
+template<typename V, bool = is_empty<V>::value>
+struct ValueHolder
+{
+  V value;
+};
+
+
+template<typename V>
+struct ValueHolder<V, true>
+{
+  // an empty type has nothing to store, so every node shares this
+  static V value;
+};
+
+
+template<typename V>
+V ValueHolder<V, true>::value;
+
+
+#endif